@@ -0,0 +1,179 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file U8g2lib.h
+ * @brief U8g2 shim for the native host build: a virtual SSD1306 frame buffer.
+ *
+ * The classes below reproduce the frame buffer layout of U8g2 (pages of 8 pixel rows, one byte per
+ * column, top pixel in the least significant bit) and the drawing primitives used by the firmware,
+ * with the same pixel output. Transfers to the panel are copied into an emulated SSD1306 display RAM
+ * and counted, which gives the bytes that would go over I2C.
+ *
+ * Text is measured with fixed metrics but not rasterized.
+ */
+
+#ifndef U8G2LIB_H
+#define U8G2LIB_H
+
+#include <Arduino.h>
+
+typedef uint16_t u8g2_uint_t;
+
+/** @brief Display rotation, only U8G2_R0 is supported. */
+typedef struct
+{
+    uint8_t rotation;
+} u8g2_cb_t;
+
+extern const u8g2_cb_t *U8G2_R0;
+
+#define U8X8_PIN_NONE 255
+#define U8G2_DRAW_UPPER_RIGHT 0x01
+#define U8G2_DRAW_UPPER_LEFT 0x02
+#define U8G2_DRAW_LOWER_LEFT 0x04
+#define U8G2_DRAW_LOWER_RIGHT 0x08
+#define U8G2_DRAW_ALL (U8G2_DRAW_UPPER_RIGHT | U8G2_DRAW_UPPER_LEFT | U8G2_DRAW_LOWER_RIGHT | U8G2_DRAW_LOWER_LEFT)
+
+/**
+ * @brief Drawing state of U8g2 read by the firmware, fields named as in u8g2_t.
+ */
+typedef struct
+{
+    uint8_t draw_color;          ///< 0 clears, 1 sets, 2 inverts.
+    uint8_t bitmap_transparency; ///< Whether the 0 bits of bitmaps are left untouched.
+} u8g2_t;
+
+/**
+ * @brief Emulated SSD1306 controller.
+ */
+typedef struct
+{
+    uint8_t gddram[128 * 64 / 8]; ///< Display RAM, same layout as the U8g2 full buffer.
+    uint32_t busBytes;            ///< Number of display RAM bytes transferred.
+    uint32_t transfers;           ///< Number of tile transfers.
+} u8x8_t;
+
+/**
+ * @brief Copies tiles into the display RAM of the emulated controller.
+ *
+ * @param u8x8 The emulated controller.
+ * @param x Column of the first tile.
+ * @param y Row of the tiles.
+ * @param cnt Number of tiles.
+ * @param tile_ptr Tiles, 8 bytes each.
+ */
+void u8x8_DrawTile(u8x8_t *u8x8, uint8_t x, uint8_t y, uint8_t cnt, uint8_t *tile_ptr);
+
+/** @brief Fonts used by the firmware: ascent, descent and advance width. */
+extern const uint8_t u8g2_font_helvR10_tf[];
+extern const uint8_t u8g2_font_ncenB08_tr[];
+
+/**
+ * @brief Virtual frame buffer implementing the U8G2 drawing API.
+ */
+class U8G2
+{
+public:
+    bool begin();
+    void clearBuffer();
+    void clearDisplay();
+    void sendBuffer();
+    void updateDisplayArea(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th);
+    void firstPage();
+    uint8_t nextPage();
+
+    uint8_t *getBufferPtr() { return buffer; }
+    uint8_t getBufferTileWidth() { return 16; }
+    uint8_t getBufferTileHeight() { return tileHeight; }
+    uint8_t getBufferCurrTileRow() { return currentTileRow; }
+    u8x8_t *getU8x8() { return &u8x8; }
+    u8g2_t *getU8g2() { return &u8g2; }
+    u8g2_uint_t getDisplayWidth() { return 128; }
+    u8g2_uint_t getDisplayHeight() { return 64; }
+
+    void setDrawColor(uint8_t color) { u8g2.draw_color = color; }
+    uint8_t getDrawColor() { return u8g2.draw_color; }
+    void setBitmapMode(uint8_t isTransparent) { u8g2.bitmap_transparency = isTransparent; }
+
+    void setFont(const uint8_t *font) { this->font = font; }
+    int8_t getAscent() { return (int8_t)font[0]; }
+    int8_t getDescent() { return (int8_t)font[1]; }
+    u8g2_uint_t getUTF8Width(const char *str) { return (u8g2_uint_t)(font[2] * strlen(str)); }
+    u8g2_uint_t drawStr(u8g2_uint_t, u8g2_uint_t, const char *str) { return getUTF8Width(str); }
+
+    void drawPixel(u8g2_uint_t x, u8g2_uint_t y);
+    void drawHLine(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w);
+    void drawVLine(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t h);
+    void drawBox(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h);
+    void drawDisc(u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rad, uint8_t opt = U8G2_DRAW_ALL);
+    void drawXBMP(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap);
+
+protected:
+    /**
+     * @param buffer Frame buffer, 128 bytes per page.
+     * @param tileHeight Number of pages held by the buffer.
+     */
+    U8G2(uint8_t *buffer, uint8_t tileHeight) : buffer(buffer), tileHeight(tileHeight) {}
+
+private:
+    void drawDiscSection(int x, int y, int x0, int y0, uint8_t option);
+
+    uint8_t *buffer;              ///< Frame buffer.
+    uint8_t tileHeight;           ///< Number of pages held by the buffer.
+    uint8_t currentTileRow = 0;   ///< First page held by the buffer in page mode.
+    u8g2_t u8g2 = {1, 0};         ///< Draw color and bitmap mode.
+    const uint8_t *font = u8g2_font_ncenB08_tr; ///< Current font metrics.
+    u8x8_t u8x8 = {};             ///< Emulated controller.
+};
+
+/**
+ * @brief Full buffer SSD1306 128x64 display, as in U8g2.
+ */
+class U8G2_SSD1306_128X64_NONAME_F_HW_I2C : public U8G2
+{
+public:
+    U8G2_SSD1306_128X64_NONAME_F_HW_I2C(const u8g2_cb_t * /*rotation*/, uint8_t /*reset*/ = U8X8_PIN_NONE,
+                                        uint8_t /*clock*/ = U8X8_PIN_NONE, uint8_t /*data*/ = U8X8_PIN_NONE)
+        : U8G2(frame, 8) {}
+
+private:
+    uint8_t frame[128 * 64 / 8]; ///< Full frame buffer.
+};
+
+/**
+ * @brief Page buffer SSD1306 128x64 display, as in U8g2: one page is held and drawn at a time.
+ */
+class U8G2_SSD1306_128X64_NONAME_1_HW_I2C : public U8G2
+{
+public:
+    U8G2_SSD1306_128X64_NONAME_1_HW_I2C(const u8g2_cb_t * /*rotation*/, uint8_t /*reset*/ = U8X8_PIN_NONE,
+                                        uint8_t /*clock*/ = U8X8_PIN_NONE, uint8_t /*data*/ = U8X8_PIN_NONE)
+        : U8G2(page, 1) {}
+
+private:
+    uint8_t page[128]; ///< Page buffer.
+};
+
+#endif // U8G2LIB_H
@@ -0,0 +1,167 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file hostShim.h
+ * @brief Host side controls of the native build shims.
+ *
+ * These functions do not exist on the target. They let the host program and host tests look at
+ * the state of the emulated hardware.
+ */
+
+#ifndef HOSTSHIM_H
+#define HOSTSHIM_H
+
+#include <Arduino.h>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Checks whether the standard input is closed and all its bytes have been read.
+ */
+bool hostSerialEof();
+
+/**
+ * @brief Returns the level last written to a virtual GPIO.
+ * @param pin The GPIO number.
+ */
+int hostGpioLevel(uint8_t pin);
+
+/**
+ * @brief Returns the number of digitalWrite() calls since startup.
+ */
+uint32_t hostGpioWrites();
+
+/**
+ * @brief Sends what the firmware writes to Serial into a string instead of the standard output.
+ *
+ * Meant for tests running in virtual time, where a single task writes at a time.
+ *
+ * @param sink String receiving the bytes, NULL to write to the standard output again.
+ */
+void hostCaptureSerial(std::string *sink);
+
+// Virtual time ================================================
+
+/**
+ * @brief Switches the tasks to the deterministic virtual clock, to call before setup().
+ *
+ * The tasks then run one at a time and the clock only moves when they all wait, jumping to the
+ * next wake-up time or scheduled serial input. Once nothing is left to happen, onIdle is called
+ * and the program exits.
+ *
+ * @param onIdle Called at the end of the simulation, may be NULL.
+ */
+void hostUseVirtualTime(void (*onIdle)());
+
+/**
+ * @brief Checks whether the virtual clock is in use.
+ */
+bool hostVirtualTime();
+
+/**
+ * @brief Returns the virtual time in microseconds.
+ */
+uint64_t hostVirtualMicros();
+
+/**
+ * @brief Returns the number of times a blocked task was resumed in virtual time.
+ *
+ * Every return from delay(), vTaskDelay() or a blocking ulTaskNotifyTake() counts, so the difference
+ * over a time window gives the task wakeups the firmware spent in it.
+ */
+uint32_t hostWakeups();
+
+/**
+ * @brief Blocks the calling task for the given virtual time, delay() in virtual time.
+ * @param ms Delay in milliseconds.
+ */
+void hostVirtualDelay(unsigned long ms);
+
+/**
+ * @brief Calls loop() until the virtual clock reaches the given time, for tests.
+ *
+ * The loop task waiting for a notification then wakes up at that time at the latest, so the
+ * simulation never ends while a test drives it.
+ *
+ * @param atMs Virtual time in milliseconds since startup.
+ */
+void hostRunUntil(uint32_t atMs);
+
+/**
+ * @brief Schedules serial input in virtual time.
+ *
+ * The bytes are appended to the receive buffer and the onReceive() callback is fired once the
+ * virtual clock reaches the given time. Input scheduled for the same time is delivered at once.
+ *
+ * @param atMs Delivery time in milliseconds since startup.
+ * @param data The bytes.
+ * @param length Number of bytes.
+ */
+void hostSerialInput(uint32_t atMs, const uint8_t *data, size_t length);
+
+/**
+ * @brief Returns the time of the next scheduled serial input in microseconds, UINT64_MAX if none.
+ */
+uint64_t hostNextSerialInput();
+
+/**
+ * @brief Delivers the serial input scheduled up to the given virtual time.
+ * @param now Virtual time in microseconds.
+ */
+void hostDeliverSerialInput(uint64_t now);
+
+/**
+ * @brief Hardware event recorded in virtual time.
+ */
+struct HostTimelineEntry
+{
+    uint64_t time;    ///< Virtual time in microseconds.
+    char kind;        ///< 'G' for a GPIO write, 'D' for a display transfer.
+    uint8_t a;        ///< GPIO number, or tile row.
+    uint8_t b;        ///< GPIO level, or first tile column.
+    uint8_t c;        ///< Number of tiles.
+};
+
+/**
+ * @brief Returns the GPIO writes and display transfers recorded in virtual time, in time order.
+ */
+const std::vector<HostTimelineEntry> &hostTimeline();
+
+/**
+ * @brief Records a transfer of tiles to the display in the timeline.
+ *
+ * @param row Tile row.
+ * @param x First tile column.
+ * @param tiles Number of tiles.
+ */
+void hostRecordDisplay(uint8_t row, uint8_t x, uint8_t tiles);
+
+/**
+ * @brief Prints the GPIO writes and display transfers recorded in virtual time, one per line.
+ * @param out Where to print.
+ */
+void hostPrintTimeline(Print &out);
+
+#endif // HOSTSHIM_H
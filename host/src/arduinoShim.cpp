@@ -0,0 +1,381 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file arduinoShim.cpp
+ * @brief Arduino core shim for the native host build.
+ *
+ * Serial reads the standard input from a reader thread, which plays the part of the UART driver:
+ * each chunk read is appended to the receive buffer, then the onReceive() callback is fired.
+ *
+ * In virtual time there is no reader thread: the input is scheduled up front with hostSerialInput()
+ * and delivered by the scheduler of freertosShim.cpp once the virtual clock reaches its time. The
+ * GPIO writes and the display transfers are then recorded in a timeline.
+ */
+
+#include <Arduino.h>
+#include <esp_timer.h>
+#include "hostShim.h"
+#include <chrono>
+#include <cstdarg>
+#include <deque>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+HardwareSerial Serial;
+
+/// Start of the program on the host monotonic clock
+static const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+/// Levels of the virtual GPIOs
+static uint8_t gpioLevels[HOST_GPIO_COUNT];
+
+/// Number of digitalWrite() calls
+static uint32_t gpioWrites = 0;
+
+/// Protects the receive buffer
+static std::mutex rxMutex;
+
+/// Bytes received and not read yet
+static std::deque<uint8_t> rxBuffer;
+
+/// Callback fired after each received chunk
+static void (*rxCallback)(void) = NULL;
+
+/// Whether the standard input is closed
+static volatile bool rxEof = false;
+
+/// Whether the reader thread is started
+static bool rxStarted = false;
+
+/**
+ * @brief Serial input delivered at a given virtual time.
+ */
+struct ScheduledInput
+{
+    uint64_t time;                 ///< Delivery time in microseconds.
+    std::vector<uint8_t> data;     ///< Bytes received.
+};
+
+/// Serial input not delivered yet, in time order
+static std::deque<ScheduledInput> scheduledInput;
+
+/// Recorded hardware events
+static std::vector<HostTimelineEntry> timeline;
+
+/// String receiving the Serial output, NULL for the standard output
+static std::string *txSink = NULL;
+
+// Print ================================================
+
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        write(buffer[i]);
+    }
+    return size;
+}
+
+size_t Print::print(long value)
+{
+    char text[24];
+    snprintf(text, sizeof(text), "%ld", value);
+    return write(text);
+}
+
+size_t Print::print(unsigned long value)
+{
+    char text[24];
+    snprintf(text, sizeof(text), "%lu", value);
+    return write(text);
+}
+
+size_t Print::print(double value, int digits)
+{
+    char text[48];
+    snprintf(text, sizeof(text), "%.*f", digits, value);
+    return write(text);
+}
+
+size_t Print::printf(const char *format, ...)
+{
+    char text[256];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    if (length < 0)
+    {
+        return 0;
+    }
+    return write((const uint8_t *)text, min((size_t)length, sizeof(text) - 1));
+}
+
+// Serial ================================================
+
+/**
+ * @brief Reader thread, moves the standard input into the receive buffer.
+ */
+static void serialReader()
+{
+    uint8_t chunk[64];
+    while (true)
+    {
+        ssize_t length = ::read(STDIN_FILENO, chunk, sizeof(chunk));
+        {
+            std::lock_guard<std::mutex> lock(rxMutex);
+            if (length <= 0)
+            {
+                rxEof = true;
+            }
+            else
+            {
+                rxBuffer.insert(rxBuffer.end(), chunk, chunk + length);
+            }
+        }
+        if (rxCallback != NULL)
+        {
+            rxCallback();
+        }
+        if (length <= 0)
+        {
+            return;
+        }
+    }
+}
+
+void HardwareSerial::begin(unsigned long)
+{
+    if (!rxStarted && !hostVirtualTime())
+    {
+        rxStarted = true;
+        std::thread(serialReader).detach();
+    }
+}
+
+int HardwareSerial::available()
+{
+    std::lock_guard<std::mutex> lock(rxMutex);
+    return (int)rxBuffer.size();
+}
+
+int HardwareSerial::read()
+{
+    std::lock_guard<std::mutex> lock(rxMutex);
+    if (rxBuffer.empty())
+    {
+        return -1;
+    }
+    int c = rxBuffer.front();
+    rxBuffer.pop_front();
+    return c;
+}
+
+void HardwareSerial::onReceive(void (*callback)(void), bool)
+{
+    rxCallback = callback;
+}
+
+size_t HardwareSerial::write(uint8_t c)
+{
+    if (txSink != NULL)
+    {
+        txSink->push_back((char)c);
+        return 1;
+    }
+    fputc(c, stdout);
+    if (c == '\n' || c == 0)
+    {
+        fflush(stdout);
+    }
+    return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size)
+{
+    if (txSink != NULL)
+    {
+        txSink->append((const char *)buffer, size);
+        return size;
+    }
+    fwrite(buffer, 1, size, stdout);
+    // Flush at the end of a text line or of a binary packet
+    if (memchr(buffer, '\n', size) != NULL || memchr(buffer, 0, size) != NULL)
+    {
+        fflush(stdout);
+    }
+    return size;
+}
+
+void hostCaptureSerial(std::string *sink)
+{
+    fflush(stdout);
+    txSink = sink;
+}
+
+bool hostSerialEof()
+{
+    std::lock_guard<std::mutex> lock(rxMutex);
+    if (hostVirtualTime())
+    {
+        return scheduledInput.empty() && rxBuffer.empty();
+    }
+    return rxEof && rxBuffer.empty();
+}
+
+void hostSerialInput(uint32_t atMs, const uint8_t *data, size_t length)
+{
+    uint64_t time = (uint64_t)atMs * 1000;
+    if (!scheduledInput.empty() && scheduledInput.back().time == time)
+    {
+        scheduledInput.back().data.insert(scheduledInput.back().data.end(), data, data + length);
+        return;
+    }
+    auto at = scheduledInput.end();
+    while (at != scheduledInput.begin() && (at - 1)->time > time)
+    {
+        --at;
+    }
+    scheduledInput.insert(at, ScheduledInput{time, std::vector<uint8_t>(data, data + length)});
+}
+
+uint64_t hostNextSerialInput()
+{
+    return scheduledInput.empty() ? UINT64_MAX : scheduledInput.front().time;
+}
+
+void hostDeliverSerialInput(uint64_t now)
+{
+    while (!scheduledInput.empty() && scheduledInput.front().time <= now)
+    {
+        {
+            std::lock_guard<std::mutex> lock(rxMutex);
+            rxBuffer.insert(rxBuffer.end(), scheduledInput.front().data.begin(), scheduledInput.front().data.end());
+        }
+        scheduledInput.pop_front();
+        if (rxCallback != NULL)
+        {
+            rxCallback();
+        }
+    }
+}
+
+// Time ================================================
+
+int64_t esp_timer_get_time()
+{
+    if (hostVirtualTime())
+    {
+        return (int64_t)hostVirtualMicros();
+    }
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+unsigned long micros()
+{
+    return (unsigned long)esp_timer_get_time();
+}
+
+unsigned long millis()
+{
+    return (unsigned long)(esp_timer_get_time() / 1000);
+}
+
+void delay(unsigned long ms)
+{
+    if (hostVirtualTime())
+    {
+        hostVirtualDelay(ms);
+        return;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+// GPIO ================================================
+
+void pinMode(uint8_t, uint8_t)
+{
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+    if (pin < HOST_GPIO_COUNT)
+    {
+        gpioLevels[pin] = value ? HIGH : LOW;
+    }
+    gpioWrites++;
+    if (hostVirtualTime())
+    {
+        timeline.push_back(HostTimelineEntry{hostVirtualMicros(), 'G', pin, (uint8_t)(value ? HIGH : LOW), 0});
+    }
+}
+
+int digitalRead(uint8_t pin)
+{
+    return pin < HOST_GPIO_COUNT ? gpioLevels[pin] : LOW;
+}
+
+int hostGpioLevel(uint8_t pin)
+{
+    return digitalRead(pin);
+}
+
+uint32_t hostGpioWrites()
+{
+    return gpioWrites;
+}
+
+// Timeline ================================================
+
+void hostRecordDisplay(uint8_t row, uint8_t x, uint8_t tiles)
+{
+    if (hostVirtualTime())
+    {
+        timeline.push_back(HostTimelineEntry{hostVirtualMicros(), 'D', row, x, tiles});
+    }
+}
+
+const std::vector<HostTimelineEntry> &hostTimeline()
+{
+    return timeline;
+}
+
+void hostPrintTimeline(Print &out)
+{
+    for (const HostTimelineEntry &entry : timeline)
+    {
+        if (entry.kind == 'G')
+        {
+            out.printf("TL:%llu.%03llu GPIO %u=%u\n", (unsigned long long)(entry.time / 1000),
+                       (unsigned long long)(entry.time % 1000), entry.a, entry.b);
+        }
+        else
+        {
+            out.printf("TL:%llu.%03llu DISPLAY row=%u x=%u tiles=%u\n", (unsigned long long)(entry.time / 1000),
+                       (unsigned long long)(entry.time % 1000), entry.a, entry.b, entry.c);
+        }
+    }
+}
@@ -0,0 +1,326 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file freertosShim.cpp
+ * @brief FreeRTOS shim for the native host build.
+ *
+ * Each task is a std::thread, the core affinity and the priority are ignored. The thread running
+ * main() stands for the Arduino loop task. Task notifications are counters protected by a mutex.
+ *
+ * With hostUseVirtualTime(), the tasks run one at a time on a virtual clock instead. The running
+ * task keeps the CPU until it blocks in delay(), vTaskDelay() or ulTaskNotifyTake(). The next task
+ * is then chosen round robin among the ready ones and, when none is ready, the clock jumps to the
+ * next wake-up time or scheduled serial input. Code runs in zero virtual time, so a run is exactly
+ * reproducible and the delays of the firmware cost nothing. The simulation ends once every task is
+ * blocked forever and no serial input is left, unless a test drives loop() with hostRunUntil().
+ */
+
+#include <Arduino.h>
+#include "hostShim.h"
+#include <condition_variable>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+/// Wake-up time of a task blocked without timeout
+static const uint64_t NEVER = UINT64_MAX;
+
+/**
+ * @brief Task control block.
+ */
+struct HostTask
+{
+    const char *name;        ///< Task name.
+    uint32_t notification;   ///< Notification value.
+    bool blocked;            ///< Virtual time: whether the task waits for its wake-up time or a notification.
+    bool waitNotify;         ///< Virtual time: whether a notification wakes the task up.
+    uint64_t wakeTime;       ///< Virtual time: wake-up time in microseconds, NEVER for none.
+};
+
+/// Protects the notification values
+static std::mutex notifyMutex;
+
+/// Signaled when a notification is given
+static std::condition_variable notifyCondition;
+
+/// Task standing for the Arduino loop task
+static HostTask loopTask = {"loopTask", 0, false, false, NEVER};
+
+/// Task running on the current thread
+static thread_local HostTask *currentTask = &loopTask;
+
+/// Whether the tasks run on the virtual clock
+static bool virtualMode = false;
+
+/// Virtual clock, in microseconds
+static uint64_t virtualNow = 0;
+
+/// Tasks in creation order, in virtual time
+static std::vector<HostTask *> tasks;
+
+/// Protects the scheduler state in virtual time
+static std::mutex batonMutex;
+
+/// Signaled when the CPU is handed over to another task
+static std::condition_variable batonCondition;
+
+/// Task allowed to run in virtual time
+static HostTask *batonHolder = &loopTask;
+
+/// Called when the simulation is over
+static void (*idleHandler)() = NULL;
+
+/// Number of times a blocked task was resumed
+static uint32_t wakeups = 0;
+
+/// Latest wake-up time of the loop task waiting for a notification, set by hostRunUntil()
+static uint64_t loopDeadline = NEVER;
+
+void loop();
+
+void hostUseVirtualTime(void (*onIdle)())
+{
+    virtualMode = true;
+    idleHandler = onIdle;
+    tasks.push_back(&loopTask);
+}
+
+bool hostVirtualTime()
+{
+    return virtualMode;
+}
+
+uint64_t hostVirtualMicros()
+{
+    return virtualNow;
+}
+
+uint32_t hostWakeups()
+{
+    return wakeups;
+}
+
+/**
+ * @brief Checks whether a task can run at the current virtual time.
+ */
+static bool isReady(const HostTask *task)
+{
+    return !task->blocked || (task->waitNotify && task->notification > 0) || task->wakeTime <= virtualNow;
+}
+
+/**
+ * @brief Chooses the next task to run, advancing the virtual clock if none is ready.
+ *
+ * Called with batonMutex held. The tasks are scanned round robin from the one after the caller.
+ */
+static HostTask *pickNextTask(HostTask *self)
+{
+    size_t first = 0;
+    for (size_t i = 0; i < tasks.size(); i++)
+    {
+        if (tasks[i] == self)
+        {
+            first = i + 1;
+        }
+    }
+
+    while (true)
+    {
+        for (size_t i = 0; i < tasks.size(); i++)
+        {
+            HostTask *task = tasks[(first + i) % tasks.size()];
+            if (isReady(task))
+            {
+                return task;
+            }
+        }
+
+        // Nothing to run: jump to the next event
+        uint64_t next = hostNextSerialInput();
+        for (HostTask *task : tasks)
+        {
+            next = min(next, task->wakeTime);
+        }
+        if (next == NEVER)
+        {
+            if (idleHandler != NULL)
+            {
+                idleHandler();
+            }
+            fflush(stdout);
+            _exit(0);
+        }
+        virtualNow = max(virtualNow, next);
+        hostDeliverSerialInput(virtualNow);
+    }
+}
+
+/**
+ * @brief Blocks the current task in virtual time and runs the other tasks meanwhile.
+ *
+ * @param wakeTime Virtual time at which the task wakes up, NEVER for none.
+ * @param waitNotify Whether a notification wakes the task up.
+ */
+static void virtualBlock(uint64_t wakeTime, bool waitNotify)
+{
+    HostTask *self = currentTask;
+    std::unique_lock<std::mutex> lock(batonMutex);
+    self->blocked = true;
+    self->waitNotify = waitNotify;
+    self->wakeTime = wakeTime;
+
+    HostTask *next = pickNextTask(self);
+    wakeups++;
+    next->blocked = false;
+    next->wakeTime = NEVER;
+    batonHolder = next;
+    batonCondition.notify_all();
+    batonCondition.wait(lock, [self]()
+                        { return batonHolder == self; });
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char *name, uint32_t, void *parameters, UBaseType_t,
+                                   TaskHandle_t *handle, BaseType_t)
+{
+    HostTask *tcb = new HostTask{name, 0, false, false, NEVER};
+    if (handle != NULL)
+    {
+        *handle = tcb;
+    }
+    if (virtualMode)
+    {
+        // Ready, it runs once the creating task blocks
+        std::lock_guard<std::mutex> lock(batonMutex);
+        tasks.push_back(tcb);
+    }
+    std::thread([tcb, task, parameters]()
+                {
+                    currentTask = tcb;
+                    if (virtualMode)
+                    {
+                        std::unique_lock<std::mutex> lock(batonMutex);
+                        batonCondition.wait(lock, [tcb]()
+                                            { return batonHolder == tcb; });
+                    }
+                    task(parameters);
+                })
+        .detach();
+    return pdPASS;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle()
+{
+    return currentTask;
+}
+
+TickType_t xTaskGetTickCount()
+{
+    return (TickType_t)millis();
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    delay(ticks);
+}
+
+void vTaskDelayUntil(TickType_t *previousWakeTime, TickType_t increment)
+{
+    *previousWakeTime += increment;
+    long remaining = (long)(*previousWakeTime - xTaskGetTickCount());
+    if (remaining > 0)
+    {
+        delay(remaining);
+    }
+}
+
+void hostVirtualDelay(unsigned long ms)
+{
+    virtualBlock(virtualNow + (uint64_t)ms * 1000, false);
+}
+
+void hostRunUntil(uint32_t atMs)
+{
+    loopDeadline = (uint64_t)atMs * 1000;
+    while (virtualNow < loopDeadline)
+    {
+        loop();
+    }
+    loopDeadline = NEVER;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    if (virtualMode)
+    {
+        // Only the running task or the scheduler get here, one at a time
+        ((HostTask *)task)->notification++;
+        return pdPASS;
+    }
+
+    std::lock_guard<std::mutex> lock(notifyMutex);
+    ((HostTask *)task)->notification++;
+    notifyCondition.notify_all();
+    return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticksToWait)
+{
+    HostTask *task = currentTask;
+
+    if (virtualMode)
+    {
+        if (task->notification == 0 && ticksToWait > 0)
+        {
+            uint64_t wakeTime = (ticksToWait == portMAX_DELAY) ? NEVER : virtualNow + (uint64_t)ticksToWait * 1000;
+            virtualBlock((task == &loopTask) ? min(wakeTime, loopDeadline) : wakeTime, true);
+        }
+        uint32_t value = task->notification;
+        if (value > 0)
+        {
+            task->notification = clearOnExit ? 0 : value - 1;
+        }
+        return value;
+    }
+
+    std::unique_lock<std::mutex> lock(notifyMutex);
+    auto notified = [task]()
+    { return task->notification > 0; };
+
+    if (ticksToWait == portMAX_DELAY)
+    {
+        notifyCondition.wait(lock, notified);
+    }
+    else
+    {
+        notifyCondition.wait_for(lock, std::chrono::milliseconds(ticksToWait), notified);
+    }
+
+    uint32_t value = task->notification;
+    if (value > 0)
+    {
+        task->notification = clearOnExit ? 0 : value - 1;
+    }
+    return value;
+}
@@ -0,0 +1,468 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file hostMain.cpp
+ * @brief Entry point of the firmware in the native host build.
+ *
+ * Runs setup() then loop() like the Arduino core, with Serial on the standard input and output.
+ * Once the standard input is closed, loop() keeps running for the number of milliseconds given as
+ * first argument (0 by default), then the program exits.
+ *
+ * Example: printf 'ESP32?\nN:2\n' | .pio/build/native/program 13000
+ *
+ * With --led-trace [ms] as arguments, the program prints the level changes of the blink pattern of
+ * each LED status over the given time window (3000 ms by default) and exits.
+ *
+ * With --virtual the firmware runs on the deterministic virtual clock of hostShim.h. The standard
+ * input is read as a script first: a line "@<ms>" gives the virtual time at which the following
+ * lines are received, the other lines are commands. The program exits once every task waits for
+ * good, after printing the GPIO and display timeline when --timeline is also given. The 12 seconds
+ * of the joysticks bring-up then take a few milliseconds.
+ *
+ * Example: printf 'ESP32?\n@13000\nN:2\n' | .pio/build/native/program --virtual --timeline
+ *
+ * With --screens <dir> [repeat] the program renders every screen of bitmapManager.cpp, the joystick
+ * screen for 0 to 4 players and the bring-up progress, and exits. The display RAM of the emulated
+ * SSD1306 after each screen is written to <dir>/<screen>.pbm, and one line per screen gives its CRC16,
+ * the time to switch to it from the previous screen and its average render time from scratch over
+ * repeat runs (100 by default), each run sending the full frame.
+ * Comparing the PBM files or the CRCs with those of a reference build shows any pixel change.
+ *
+ * With --assets [repeat] the program prints the packed and decoded size of every bitmap of assets.h
+ * and the average time drawAsset() takes to decode it into the frame buffer over repeat runs (1000
+ * by default), then exits.
+ *
+ * With --blit [repeat] the program unpacks every bitmap of assets.h to XBM and draws it with
+ * U8G2::drawXBMP() and with CustomDisplay::drawXBMP(), at a page aligned and at an unaligned y. It
+ * prints the average CPU cycles per bitmap of both over repeat runs (1000 by default), flags any
+ * difference between their output, and exits. U8G2::drawXBMP() is the simple per pixel version of the
+ * host shim, not the U8g2 library, so the speedups are relative to the shim only and say little about
+ * the gain over the real library on the ESP32.
+ *
+ * The file is left out of the unit test builds, where the Unity runner of each test provides main().
+ */
+
+#if !defined(UNIT_TEST) && !defined(PIO_UNIT_TESTING)
+
+#include <Arduino.h>
+#include "hostShim.h"
+#include "assets.h"
+#include "binaryProtocol.h"
+#include "bitmapManager.h"
+#include "ledStatus.h"
+#include <atomic>
+#include <thread>
+#include <unistd.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+void setup();
+void loop();
+
+/// Set when the program must exit
+static std::atomic<bool> exitRequested(false);
+
+/// Whether to print the timeline at the end of a virtual time run
+static bool printTimeline = false;
+
+/**
+ * @brief Prints the trace of the blink pattern of every LED status.
+ * @param windowMs Length of the traces in milliseconds.
+ */
+static void printLedTraces(uint32_t windowMs)
+{
+    static const char *const names[] = {"OFF", "READY", "WAITING", "CONFIG"};
+    for (int status = OFF; status <= CONFIG; status++)
+    {
+        printLedPatternTrace(names[status], LED_PATTERNS[status], windowMs, Serial);
+    }
+}
+
+/**
+ * @brief Screen rendered by --screens.
+ */
+struct HostScreen
+{
+    const char *name;    ///< Name of the screen, also the name of its PBM file.
+    LedStatus status;    ///< Status selecting the star variant.
+    void (*render)();    ///< Draws the screen and sends it to the display.
+};
+
+/// Screens rendered by --screens, the joystick screens in the order used by flushPlayers()
+static const HostScreen SCREENS[] = {
+    {"loading", CONFIG, drawLoadingScreen},
+    {"waiting", WAITING, waitingScreen},
+    {"ready", READY, readyScreen},
+    {"starting", READY, startingScreen},
+    {"stopping", READY, stoppingScreen},
+    {"stopped", READY, stoppedScreen},
+    {"joystick0", READY, []() { joystickScreen(0); }},
+    {"joystick1", READY, []() { joystickScreen(1); }},
+    {"joystick2", READY, []() { joystickScreen(2); }},
+    {"joystick3", READY, []() { joystickScreen(3); }},
+    {"joystick4", READY, []() { joystickScreen(4); }},
+    {"progress25", CONFIG, []() { progressScreen(25); }},
+    {"progress50", CONFIG, []() { progressScreen(50); }},
+    {"progress75", CONFIG, []() { progressScreen(75); }},
+    {"progress100", CONFIG, []() { progressScreen(100); }},
+};
+
+/**
+ * @brief Writes a frame in the U8g2 buffer layout as a binary PBM image.
+ *
+ * @param path Path of the image.
+ * @param frame The frame, 128 bytes per page, top pixel in the least significant bit.
+ * @return true if the file was written.
+ */
+static bool writePbm(const char *path, const uint8_t *frame)
+{
+    FILE *file = fopen(path, "wb");
+    if (file == NULL)
+    {
+        return false;
+    }
+    fprintf(file, "P4\n128 64\n");
+    for (int y = 0; y < 64; y++)
+    {
+        uint8_t row[16] = {};
+        for (int x = 0; x < 128; x++)
+        {
+            if (frame[(y / 8) * 128 + x] & (1 << (y % 8)))
+            {
+                row[x / 8] |= 0x80 >> (x % 8);
+            }
+        }
+        fwrite(row, 1, sizeof(row), file);
+    }
+    return fclose(file) == 0;
+}
+
+/**
+ * @brief Renders every screen, writes its PBM image and prints its CRC and render times.
+ *
+ * Each screen is first shown repeat times right after the previous one, as the firmware does, then
+ * drawn from scratch repeat times. Both must give the same frame.
+ *
+ * Output format: SCREEN:<name>:crc=<hex>,switch_us=<from previous>,render_us=<average>,max_us=<max>
+ * with ",MISMATCH" appended when the frames differ.
+ *
+ * @param dir Directory receiving the images.
+ * @param repeat Number of timed renders of each screen.
+ * @return 0 on success, 1 if an image could not be written or the frames differ.
+ */
+static int renderScreens(const char *dir, uint32_t repeat)
+{
+    display.begin();
+    int result = 0;
+    uint32_t runs = max(repeat, (uint32_t)1);
+    const HostScreen *previous = &SCREENS[0];
+    for (const HostScreen &screen : SCREENS)
+    {
+        const uint8_t *frame = display.getU8x8()->gddram;
+        uint32_t switchTotal = 0;
+        for (uint32_t i = 0; i < runs; i++)
+        {
+            setLedStatus(previous->status);
+            previous->render();
+            setLedStatus(screen.status);
+            unsigned long start = micros();
+            screen.render();
+            switchTotal += micros() - start;
+        }
+        uint16_t switchCrc = crc16(frame, CustomDisplay::FRAME_SIZE);
+        previous = &screen;
+
+        uint32_t total = 0;
+        uint32_t longest = 0;
+        for (uint32_t i = 0; i < runs; i++)
+        {
+            display.invalidate();
+            invalidateScreen();
+            unsigned long start = micros();
+            screen.render();
+            uint32_t elapsed = micros() - start;
+            total += elapsed;
+            longest = max(longest, elapsed);
+        }
+
+        char path[256];
+        snprintf(path, sizeof(path), "%s/%s.pbm", dir, screen.name);
+        if (!writePbm(path, frame))
+        {
+            fprintf(stderr, "cannot write %s\n", path);
+            result = 1;
+        }
+        uint16_t crc = crc16(frame, CustomDisplay::FRAME_SIZE);
+        Serial.printf("SCREEN:%s:crc=%04x,switch_us=%lu,render_us=%lu,max_us=%lu%s\n", screen.name, crc,
+                      (unsigned long)(switchTotal / runs), (unsigned long)(total / runs),
+                      (unsigned long)longest, (crc == switchCrc) ? "" : ",MISMATCH");
+        if (crc != switchCrc)
+        {
+            result = 1;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Returns the size of the bytes of an asset in ASSET_BLOB, tiles excluded.
+ *
+ * @param asset The asset.
+ * @param decoded Filled with the size of the bitmap, 1 bit per pixel.
+ */
+static uint16_t packedSize(const PackedAsset &asset, uint16_t &decoded)
+{
+    if (asset.format == ASSET_TILES)
+    {
+        decoded = asset.width * asset.height / 8;
+        return (asset.width / 8) * (asset.height / 8);
+    }
+    decoded = (asset.width + 7) / 8 * asset.height;
+    const uint8_t *data = ASSET_BLOB + asset.offset;
+    uint16_t size = 0;
+    for (uint16_t done = 0; done < decoded;)
+    {
+        uint8_t control = data[size];
+        done += (control & 0x80) ? (control & 0x7f) + 2 : control + 1;
+        size += (control & 0x80) ? 2 : control + 2;
+    }
+    return size;
+}
+
+/**
+ * @brief Prints the size of every packed asset and the time to draw it.
+ *
+ * Output format: ASSET:<name>:<width>x<height>,format=<xbm|tiles>,bytes=<packed>/<decoded>,decode_ns=<average>
+ * then ASSETS:count=<assets>,tiles=<distinct tiles>,blob=<ASSET_BLOB size>,bytes=<packed>/<decoded>
+ *
+ * @param repeat Number of timed draws of each asset.
+ * @return 0.
+ */
+static int benchAssets(uint32_t repeat)
+{
+    uint32_t runs = max(repeat, (uint32_t)1);
+    uint32_t packedTotal = 0;
+    uint32_t decodedTotal = 0;
+    for (uint8_t i = 0; i < ASSET_COUNT; i++)
+    {
+        const PackedAsset &asset = *ALL_ASSETS[i];
+        display.clearBuffer();
+        unsigned long start = micros();
+        for (uint32_t run = 0; run < runs; run++)
+        {
+            display.drawAsset(0, 0, asset);
+        }
+        unsigned long elapsed = micros() - start;
+
+        uint16_t decoded;
+        uint16_t packed = packedSize(asset, decoded);
+        packedTotal += packed;
+        decodedTotal += decoded;
+        Serial.printf("ASSET:%s:%ux%u,format=%s,bytes=%u/%u,decode_ns=%lu\n", ASSET_NAMES[i], asset.width,
+                      asset.height, (asset.format == ASSET_TILES) ? "tiles" : "xbm", packed, decoded,
+                      (unsigned long)((uint64_t)elapsed * 1000 / runs));
+    }
+    Serial.printf("ASSETS:count=%u,tiles=%u,blob=%u,bytes=%lu/%lu\n", ASSET_COUNT, ASSET_TILE_COUNT, ASSET_BLOB_SIZE,
+                  (unsigned long)packedTotal, (unsigned long)decodedTotal);
+    return 0;
+}
+
+/**
+ * @brief Returns the CPU cycle counter, or nanoseconds on hosts without one readable.
+ */
+static uint64_t cycleCount()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return (uint64_t)micros() * 1000;
+#endif
+}
+
+/**
+ * @brief Compares U8G2::drawXBMP() and CustomDisplay::drawXBMP() on every asset.
+ *
+ * Output format: BLIT:<name>:<width>x<height>,y=<y>,shim_cycles=<average>,fast_cycles=<average>,shim_speedup=<ratio>
+ * with ",MISMATCH" appended when the buffers differ. The reference is the drawXBMP() of the host U8g2 shim.
+ *
+ * @param repeat Number of timed draws of each asset.
+ * @return 0 on success, 1 if the buffers differ.
+ */
+static int benchBlit(uint32_t repeat)
+{
+    static const uint8_t ROWS[] = {0, 3};
+    static uint8_t xbm[255 / 8 * 255 + 255];
+    uint8_t expected[CustomDisplay::FRAME_SIZE];
+    uint16_t bufferSize = display.getBufferTileWidth() * 8 * display.getBufferTileHeight();
+    uint32_t runs = max(repeat, (uint32_t)1);
+    int result = 0;
+
+    for (uint8_t i = 0; i < ASSET_COUNT; i++)
+    {
+        const PackedAsset &asset = *ALL_ASSETS[i];
+        unpackAssetXbm(asset, xbm);
+        for (uint8_t y : ROWS)
+        {
+            display.clearBuffer();
+            uint64_t start = cycleCount();
+            for (uint32_t run = 0; run < runs; run++)
+            {
+                display.DisplayBase::drawXBMP(0, y, asset.width, asset.height, xbm);
+            }
+            uint64_t shimCycles = (cycleCount() - start) / runs;
+            memcpy(expected, display.getBufferPtr(), bufferSize);
+
+            display.clearBuffer();
+            start = cycleCount();
+            for (uint32_t run = 0; run < runs; run++)
+            {
+                display.drawXBMP(0, y, asset.width, asset.height, xbm);
+            }
+            uint64_t fastCycles = (cycleCount() - start) / runs;
+            bool match = memcmp(expected, display.getBufferPtr(), bufferSize) == 0;
+
+            Serial.printf("BLIT:%s:%ux%u,y=%u,shim_cycles=%lu,fast_cycles=%lu,shim_speedup=%.1f%s\n", ASSET_NAMES[i],
+                          asset.width, asset.height, y, (unsigned long)shimCycles, (unsigned long)fastCycles,
+                          (double)shimCycles / max(fastCycles, (uint64_t)1), match ? "" : ",MISMATCH");
+            if (!match)
+            {
+                result = 1;
+            }
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Ends a virtual time run, called once nothing is left to happen.
+ */
+static void onVirtualIdle()
+{
+    if (printTimeline)
+    {
+        hostPrintTimeline(Serial);
+    }
+}
+
+/**
+ * @brief Reads the input script from the standard input and schedules its lines in virtual time.
+ */
+static void scheduleScript()
+{
+    char line[256];
+    uint32_t atMs = 0;
+    while (fgets(line, sizeof(line), stdin) != NULL)
+    {
+        if (line[0] == '@')
+        {
+            atMs = strtoul(line + 1, NULL, 10);
+        }
+        else
+        {
+            hostSerialInput(atMs, (const uint8_t *)line, strlen(line));
+        }
+    }
+}
+
+/**
+ * @brief Runs the firmware in virtual time, never returns.
+ */
+static void runVirtual()
+{
+    scheduleScript();
+    hostUseVirtualTime(onVirtualIdle);
+
+    setup();
+    while (true)
+    {
+        loop();
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 2 && strcmp(argv[1], "--screens") == 0)
+    {
+        int result = renderScreens(argv[2], (argc > 3) ? strtoul(argv[3], NULL, 10) : 100);
+        fflush(stdout);
+        _exit(result);
+    }
+
+    if (argc > 1 && strcmp(argv[1], "--assets") == 0)
+    {
+        int result = benchAssets((argc > 2) ? strtoul(argv[2], NULL, 10) : 1000);
+        fflush(stdout);
+        _exit(result);
+    }
+
+    if (argc > 1 && strcmp(argv[1], "--blit") == 0)
+    {
+        int result = benchBlit((argc > 2) ? strtoul(argv[2], NULL, 10) : 1000);
+        fflush(stdout);
+        _exit(result);
+    }
+
+    if (argc > 1 && strcmp(argv[1], "--virtual") == 0)
+    {
+        printTimeline = argc > 2 && strcmp(argv[2], "--timeline") == 0;
+        runVirtual();
+    }
+
+    if (argc > 1 && strcmp(argv[1], "--led-trace") == 0)
+    {
+        printLedTraces((argc > 2) ? strtoul(argv[2], NULL, 10) : 3000);
+        fflush(stdout);
+        _exit(0);
+    }
+
+    unsigned long lingerMs = (argc > 1) ? strtoul(argv[1], NULL, 10) : 0;
+    TaskHandle_t loopTask = xTaskGetCurrentTaskHandle();
+
+    setup();
+
+    std::thread([lingerMs, loopTask]()
+                {
+                    while (!hostSerialEof())
+                    {
+                        delay(10);
+                    }
+                    delay(lingerMs);
+                    exitRequested = true;
+                    xTaskNotifyGive(loopTask);
+                })
+        .detach();
+
+    while (!exitRequested)
+    {
+        loop();
+    }
+
+    // The other tasks never return, leave without running the static destructors
+    fflush(stdout);
+    _exit(0);
+}
+
+#endif // UNIT_TEST
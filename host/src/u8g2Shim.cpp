@@ -0,0 +1,281 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file u8g2Shim.cpp
+ * @brief Virtual SSD1306 frame buffer for the native host build.
+ *
+ * The drawing primitives follow the U8g2 algorithms so the frames rendered on the host are the same
+ * as on the target, except for text which is not rasterized.
+ */
+
+#include <U8g2lib.h>
+#include "hostShim.h"
+
+/// Rotation passed to the display constructors
+static const u8g2_cb_t rotationR0 = {0};
+const u8g2_cb_t *U8G2_R0 = &rotationR0;
+
+/// Font metrics: ascent, descent, advance width
+const uint8_t u8g2_font_helvR10_tf[] = {10, (uint8_t)-3, 7};
+const uint8_t u8g2_font_ncenB08_tr[] = {8, (uint8_t)-2, 6};
+
+/**
+ * @brief Copies tiles into the display RAM of the emulated controller.
+ */
+void u8x8_DrawTile(u8x8_t *u8x8, uint8_t x, uint8_t y, uint8_t cnt, uint8_t *tile_ptr)
+{
+    if (y >= 8 || x >= 16)
+    {
+        return;
+    }
+    if (x + cnt > 16)
+    {
+        cnt = 16 - x;
+    }
+    memcpy(u8x8->gddram + y * 128 + x * 8, tile_ptr, cnt * 8);
+    u8x8->busBytes += cnt * 8;
+    u8x8->transfers++;
+    hostRecordDisplay(y, x, cnt);
+}
+
+/**
+ * @brief Initializes the display: like U8g2, clears the buffer and the panel.
+ */
+bool U8G2::begin()
+{
+    currentTileRow = 0;
+    clearDisplay();
+    return true;
+}
+
+/**
+ * @brief Clears the pages held by the buffer.
+ */
+void U8G2::clearBuffer()
+{
+    memset(buffer, 0, 128 * tileHeight);
+}
+
+/**
+ * @brief Clears the buffer and the panel.
+ */
+void U8G2::clearDisplay()
+{
+    uint8_t row = currentTileRow;
+    for (currentTileRow = 0; currentTileRow < 8; currentTileRow += tileHeight)
+    {
+        clearBuffer();
+        sendBuffer();
+    }
+    currentTileRow = row;
+}
+
+/**
+ * @brief Sends the pages held by the buffer to the panel.
+ */
+void U8G2::sendBuffer()
+{
+    for (uint8_t row = 0; row < tileHeight; row++)
+    {
+        u8x8_DrawTile(&u8x8, 0, currentTileRow + row, 16, buffer + row * 128);
+    }
+}
+
+/**
+ * @brief Sends an area of the buffer to the panel, in tiles.
+ */
+void U8G2::updateDisplayArea(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th)
+{
+    for (uint8_t row = ty; row < ty + th; row++)
+    {
+        if (row >= currentTileRow && row < currentTileRow + tileHeight)
+        {
+            u8x8_DrawTile(&u8x8, tx, row, tw, buffer + (row - currentTileRow) * 128 + tx * 8);
+        }
+    }
+}
+
+/**
+ * @brief Starts a page loop: selects the first page and clears the buffer.
+ */
+void U8G2::firstPage()
+{
+    currentTileRow = 0;
+    clearBuffer();
+}
+
+/**
+ * @brief Sends the current pages and moves to the next ones.
+ * @return 0 once the last page has been sent.
+ */
+uint8_t U8G2::nextPage()
+{
+    sendBuffer();
+    currentTileRow += tileHeight;
+    if (currentTileRow >= 8)
+    {
+        currentTileRow = 0;
+        return 0;
+    }
+    clearBuffer();
+    return 1;
+}
+
+/**
+ * @brief Draws a pixel with the draw color, if it lies in the pages held by the buffer.
+ */
+void U8G2::drawPixel(u8g2_uint_t x, u8g2_uint_t y)
+{
+    if (x >= 128 || y >= 64)
+    {
+        return;
+    }
+    int row = (y >> 3) - currentTileRow;
+    if (row < 0 || row >= tileHeight)
+    {
+        return;
+    }
+
+    uint8_t *b = buffer + row * 128 + x;
+    uint8_t mask = 1 << (y & 7);
+    if (u8g2.draw_color == 0)
+    {
+        *b &= ~mask;
+    }
+    else if (u8g2.draw_color == 1)
+    {
+        *b |= mask;
+    }
+    else
+    {
+        *b ^= mask;
+    }
+}
+
+void U8G2::drawHLine(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w)
+{
+    for (u8g2_uint_t i = 0; i < w; i++)
+    {
+        drawPixel(x + i, y);
+    }
+}
+
+void U8G2::drawVLine(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t h)
+{
+    for (u8g2_uint_t i = 0; i < h; i++)
+    {
+        drawPixel(x, y + i);
+    }
+}
+
+void U8G2::drawBox(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+    for (u8g2_uint_t i = 0; i < h; i++)
+    {
+        drawHLine(x, y + i, w);
+    }
+}
+
+/**
+ * @brief Draws the vertical lines of one step of the disc algorithm.
+ */
+void U8G2::drawDiscSection(int x, int y, int x0, int y0, uint8_t option)
+{
+    if (option & U8G2_DRAW_UPPER_RIGHT)
+    {
+        drawVLine(x0 + x, y0 - y, y + 1);
+        drawVLine(x0 + y, y0 - x, x + 1);
+    }
+    if (option & U8G2_DRAW_UPPER_LEFT)
+    {
+        drawVLine(x0 - x, y0 - y, y + 1);
+        drawVLine(x0 - y, y0 - x, x + 1);
+    }
+    if (option & U8G2_DRAW_LOWER_RIGHT)
+    {
+        drawVLine(x0 + x, y0, y + 1);
+        drawVLine(x0 + y, y0, x + 1);
+    }
+    if (option & U8G2_DRAW_LOWER_LEFT)
+    {
+        drawVLine(x0 - x, y0, y + 1);
+        drawVLine(x0 - y, y0, x + 1);
+    }
+}
+
+/**
+ * @brief Draws a filled circle, same midpoint algorithm as u8g2_DrawDisc().
+ */
+void U8G2::drawDisc(u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rad, uint8_t opt)
+{
+    int f = 1 - (int)rad;
+    int ddFx = 1;
+    int ddFy = -2 * (int)rad;
+    int x = 0;
+    int y = rad;
+
+    drawDiscSection(x, y, x0, y0, opt);
+    while (x < y)
+    {
+        if (f >= 0)
+        {
+            y--;
+            ddFy += 2;
+            f += ddFy;
+        }
+        x++;
+        ddFx += 2;
+        f += ddFx;
+        drawDiscSection(x, y, x0, y0, opt);
+    }
+}
+
+/**
+ * @brief Draws an XBM bitmap, 0 bits use the background color unless the bitmap mode is transparent.
+ */
+void U8G2::drawXBMP(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap)
+{
+    uint8_t color = u8g2.draw_color;
+    uint8_t backgroundColor = (color == 0) ? 1 : 0;
+    u8g2_uint_t rowBytes = (w + 7) / 8;
+
+    for (u8g2_uint_t row = 0; row < h; row++)
+    {
+        for (u8g2_uint_t column = 0; column < w; column++)
+        {
+            if (bitmap[row * rowBytes + column / 8] & (1 << (column & 7)))
+            {
+                u8g2.draw_color = color;
+                drawPixel(x + column, y + row);
+            }
+            else if (!u8g2.bitmap_transparency)
+            {
+                u8g2.draw_color = backgroundColor;
+                drawPixel(x + column, y + row);
+            }
+        }
+    }
+    u8g2.draw_color = color;
+}
@@ -0,0 +1,172 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Dabatnot, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file assetStore.h
+ * @brief Format of the packed bitmaps generated by tools/packAssets.py.
+ *
+ * All bitmaps live in one blob, ASSET_BLOB, aligned on 8 bytes. It starts with the distinct 8x8
+ * tiles of the ASSET_TILES bitmaps, 8 bytes each in SSD1306 page format (one byte per column, least
+ * significant bit on top), so a tile is copied as is into the display buffer. Each bitmap then starts
+ * on a 4 byte boundary, at the offset given by its PackedAsset:
+ * - ASSET_TILES: one tile number per 8x8 tile, row by row,
+ * - ASSET_XBM: XBM rows (least significant bit on the left), run length encoded as a sequence of
+ *   blocks starting with a control byte: 0x00 to 0x7f, the control byte + 1 literal bytes follow;
+ *   0x80 to 0xff, the next byte is repeated (control byte & 0x7f) + 2 times. The decoding is
+ *   streamed, a byte at a time, so CustomDisplay::drawAsset() writes the pixels straight into the
+ *   display buffer.
+ */
+
+#ifndef ASSETSTORE_H
+#define ASSETSTORE_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Layout of the decoded bytes of an asset.
+ */
+enum AssetFormat : uint8_t
+{
+    ASSET_XBM,  ///< Run length encoded XBM rows, (width + 7) / 8 bytes per row once decoded.
+    ASSET_TILES ///< Tile numbers, width / 8 per row of tiles, drawn at a page aligned y only.
+};
+
+/**
+ * @brief Packed bitmap, declared constexpr in assets.h.
+ */
+struct PackedAsset
+{
+    uint8_t width;      ///< Width in pixels, a multiple of 8 for ASSET_TILES.
+    uint8_t height;     ///< Height in pixels, a multiple of 8 for ASSET_TILES.
+    uint16_t offset;    ///< Offset of the bitmap bytes in ASSET_BLOB.
+    AssetFormat format; ///< Layout of the bitmap bytes.
+};
+
+/** @brief Size of a tile of ASSET_BLOB in bytes: 8 columns of 8 pixels. */
+static const uint8_t ASSET_TILE_SIZE = 8;
+
+/** @brief Tiles then bitmaps of all the assets, in PROGMEM, defined in assets.cpp. */
+extern const uint8_t ASSET_BLOB[];
+
+/**
+ * @brief Streaming decoder of the run length encoded bytes of an ASSET_XBM asset.
+ */
+class RleReader
+{
+public:
+    explicit RleReader(const uint8_t *data) : data(data) {}
+
+    /**
+     * @brief Returns the next decoded byte, the caller knowing the decoded size.
+     */
+    uint8_t next()
+    {
+        if (remaining == 0)
+        {
+            uint8_t control = pgm_read_byte(data++);
+            repeat = control & 0x80;
+            remaining = repeat ? (control & 0x7f) + 2 : control + 1;
+            if (repeat)
+            {
+                value = pgm_read_byte(data++);
+            }
+        }
+        remaining--;
+        return repeat ? value : pgm_read_byte(data++);
+    }
+
+    /**
+     * @brief Skips decoded bytes.
+     * @param count Number of bytes to skip.
+     */
+    void skip(uint16_t count)
+    {
+        while (count > 0)
+        {
+            if (remaining == 0)
+            {
+                next();
+                count--;
+                continue;
+            }
+            uint8_t step = count < remaining ? count : remaining;
+            if (!repeat)
+            {
+                data += step;
+            }
+            remaining -= step;
+            count -= step;
+        }
+    }
+
+private:
+    const uint8_t *data;   ///< Next encoded byte.
+    uint8_t remaining = 0; ///< Bytes left in the current block.
+    uint8_t value = 0;     ///< Repeated byte of the current block.
+    bool repeat = false;   ///< Whether the current block is a run.
+};
+
+/**
+ * @brief Unpacks an asset of either format into an XBM bitmap, (width + 7) / 8 bytes per row.
+ *
+ * Used by the host tools and tests to feed U8G2::drawXBMP() with the same pixels as drawAsset().
+ *
+ * @param asset The asset.
+ * @param xbm Filled with the bitmap.
+ */
+inline void unpackAssetXbm(const PackedAsset &asset, uint8_t *xbm)
+{
+    uint8_t rowBytes = (asset.width + 7) / 8;
+    if (asset.format == ASSET_XBM)
+    {
+        RleReader reader(ASSET_BLOB + asset.offset);
+        for (uint16_t i = 0; i < rowBytes * asset.height; i++)
+        {
+            xbm[i] = reader.next();
+        }
+        return;
+    }
+    memset(xbm, 0, rowBytes * asset.height);
+    const uint8_t *map = ASSET_BLOB + asset.offset;
+    for (uint8_t top = 0; top < asset.height; top += 8)
+    {
+        for (uint8_t left = 0; left < asset.width; left += 8)
+        {
+            const uint8_t *tile = ASSET_BLOB + pgm_read_byte(map++) * ASSET_TILE_SIZE;
+            for (uint8_t column = 0; column < 8; column++)
+            {
+                uint8_t bits = pgm_read_byte(tile + column);
+                for (uint8_t row = 0; row < 8; row++)
+                {
+                    if (bits & (1 << row))
+                    {
+                        xbm[(top + row) * rowBytes + left / 8] |= 1 << column;
+                    }
+                }
+            }
+        }
+    }
+}
+
+#endif // ASSETSTORE_H
@@ -0,0 +1,119 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Dabatnot, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file assets.h
+ * @brief Bitmaps of the firmware, packed in one aligned blob.
+ *
+ * Generated by tools/packAssets.py from assets/assets.txt and the PNG files of assets/, do not edit.
+ * Only the bitmaps referenced by the sources are kept. See assetStore.h for the format.
+ */
+
+#ifndef ASSETS_H
+#define ASSETS_H
+
+#include "assetStore.h"
+
+/** @brief Number of distinct 8x8 tiles at the start of ASSET_BLOB. */
+#define ASSET_TILE_COUNT 59
+
+/** @brief Size of ASSET_BLOB in bytes. */
+#define ASSET_BLOB_SIZE 2083
+
+// 'Azway_Logo', 70x25px, xbm, 227 bytes from 225
+constexpr PackedAsset Azway_Logo = {70, 25, 472, ASSET_XBM};
+
+// 'JoyONJ1On', 32x32px, tiles, 16 bytes from 128
+constexpr PackedAsset JoyONJ1On = {32, 32, 700, ASSET_TILES};
+
+// 'JoyONJ2On', 32x32px, tiles, 16 bytes from 128
+constexpr PackedAsset JoyONJ2On = {32, 32, 716, ASSET_TILES};
+
+// 'JoyONJ3On', 32x32px, tiles, 16 bytes from 128
+constexpr PackedAsset JoyONJ3On = {32, 32, 732, ASSET_TILES};
+
+// 'JoyONJ4On', 32x32px, tiles, 16 bytes from 128
+constexpr PackedAsset JoyONJ4On = {32, 32, 748, ASSET_TILES};
+
+// 'JoyOFFJ1Off', 32x32px, tiles, 16 bytes from 128
+constexpr PackedAsset JoyOFFJ1Off = {32, 32, 764, ASSET_TILES};
+
+// 'JoyOFFJ2Off', 32x32px, tiles, 16 bytes from 128
+constexpr PackedAsset JoyOFFJ2Off = {32, 32, 780, ASSET_TILES};
+
+// 'JoyOFFJ3Off', 32x32px, tiles, 16 bytes from 128
+constexpr PackedAsset JoyOFFJ3Off = {32, 32, 796, ASSET_TILES};
+
+// 'JoyOFFJ4Off', 32x32px, tiles, 16 bytes from 128
+constexpr PackedAsset JoyOFFJ4Off = {32, 32, 812, ASSET_TILES};
+
+// 'FrameTopFrame', 128x32px, tiles, 64 bytes from 512
+constexpr PackedAsset FrameTopFrame = {128, 32, 828, ASSET_TILES};
+
+// 'FrameBottomFrame', 128x32px, tiles, 64 bytes from 512
+constexpr PackedAsset FrameBottomFrame = {128, 32, 892, ASSET_TILES};
+
+// 'bmpStatus', 63x10px, xbm, 81 bytes from 80
+constexpr PackedAsset bmpStatus = {63, 10, 956, ASSET_XBM};
+
+// 'FrameStarBlack', 16x15px, xbm, 31 bytes from 30
+constexpr PackedAsset FrameStarBlack = {16, 15, 1040, ASSET_XBM};
+
+// 'FrameStarWhite', 16x15px, xbm, 30 bytes from 30
+constexpr PackedAsset FrameStarWhite = {16, 15, 1072, ASSET_XBM};
+
+// 'ConnectionStateConnected', 120x22px, xbm, 233 bytes from 330
+constexpr PackedAsset ConnectionStateConnected = {120, 22, 1104, ASSET_XBM};
+
+// 'ConnectionStateConnecting', 120x22px, xbm, 298 bytes from 330
+constexpr PackedAsset ConnectionStateConnecting = {120, 22, 1340, ASSET_XBM};
+
+// 'bmpRocket', 14x19px, xbm, 39 bytes from 38
+constexpr PackedAsset bmpRocket = {14, 19, 1640, ASSET_XBM};
+
+// 'bmpStarting', 80x10px, xbm, 101 bytes from 100
+constexpr PackedAsset bmpStarting = {80, 10, 1680, ASSET_XBM};
+
+// 'bmpZZZ', 17x15px, xbm, 46 bytes from 45
+constexpr PackedAsset bmpZZZ = {17, 15, 1784, ASSET_XBM};
+
+// 'bmpStopping', 80x10px, xbm, 101 bytes from 100
+constexpr PackedAsset bmpStopping = {80, 10, 1832, ASSET_XBM};
+
+// 'bmpStopped', 74x10px, xbm, 101 bytes from 100
+constexpr PackedAsset bmpStopped = {74, 10, 1936, ASSET_XBM};
+
+// 'bmpBye', 20x14px, xbm, 43 bytes from 42
+constexpr PackedAsset bmpBye = {20, 14, 2040, ASSET_XBM};
+
+/** @brief Number of packed assets. */
+#define ASSET_COUNT 22
+
+/** @brief All packed assets, to benchmark them. */
+extern const PackedAsset *const ALL_ASSETS[ASSET_COUNT];
+
+/** @brief Names of the packed assets, same order as ALL_ASSETS. */
+extern const char *const ASSET_NAMES[ASSET_COUNT];
+
+#endif // ASSETS_H
@@ -0,0 +1,191 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file binaryProtocol.h
+ * @brief Header file for the binary framed serial protocol.
+ *
+ * The host switches to the binary protocol by sending the ESP32?BIN handshake line. Once the
+ * firmware has answered "ESP32 ready BIN", both ends exchange packets instead of text lines:
+ *
+ *   seq (1 byte) | opcode (1 byte) | payload (0 to PACKET_MAX_PAYLOAD bytes) | CRC16 (2 bytes, big endian)
+ *
+ * The CRC is the CRC-16/CCITT-FALSE of seq, opcode and payload. Each packet is COBS encoded and
+ * followed by a 0x00 delimiter, so a corrupted packet is dropped without losing the next one.
+ *
+ * Commands use their text event letter as opcode ('N', 'L', 'Q', 'S', 'D', 'E', 'P') with an
+ * optional payload holding the value as a signed 32-bit little endian integer. Any text command
+ * can also be sent as an OP_TEXT packet. Every command is acknowledged by an OP_ACK packet carrying
+ * the sequence number of the command, so the host can send several commands without waiting and
+ * match the acknowledgements afterwards. The other messages of the firmware (INIT:, RX:...) are
+ * sent as OP_TEXT packets with sequence number 0.
+ *
+ * An ESP32? handshake sent as OP_TEXT packet switches back to the text protocol.
+ */
+
+#ifndef BINARYPROTOCOL_H
+#define BINARYPROTOCOL_H
+
+#include <Arduino.h>
+
+/**
+ * @enum PacketOpcode
+ * @brief Opcodes of the packets that are not commands.
+ */
+enum PacketOpcode
+{
+    OP_TEXT = 0x01, ///< Text line, a command from the host or a message from the firmware.
+    OP_ACK = 0x06   ///< Acknowledgement, payload: AckStatus then opcode of the command.
+};
+
+/**
+ * @enum AckStatus
+ * @brief Result of a command, first byte of an OP_ACK payload.
+ */
+enum AckStatus
+{
+    ACK_OK = 0,     ///< Command handled.
+    ACK_REFUSED = 1 ///< Unknown command or command refused in the current state (text ACK:?).
+};
+
+const uint8_t PACKET_MAX_PAYLOAD = 64;                       ///< Largest payload of a packet.
+const uint8_t PACKET_MAX_RAW = PACKET_MAX_PAYLOAD + 4;       ///< Largest packet before COBS encoding.
+const uint8_t PACKET_MAX_FRAME = PACKET_MAX_RAW + 2;         ///< Largest COBS frame with its delimiter.
+
+/**
+ * @brief Computes the CRC-16/CCITT-FALSE of a buffer.
+ *
+ * @param data The bytes to check.
+ * @param length Number of bytes.
+ * @param crc Initial value, the CRC of the previous bytes to chain calls.
+ */
+uint16_t crc16(const uint8_t *data, size_t length, uint16_t crc = 0xFFFF);
+
+/**
+ * @brief COBS encodes a buffer of up to 254 bytes, without the delimiter.
+ *
+ * @param in The bytes to encode.
+ * @param length Number of bytes.
+ * @param out Encoded bytes, length + 1 bytes.
+ * @return Number of encoded bytes.
+ */
+size_t cobsEncode(const uint8_t *in, size_t length, uint8_t *out);
+
+/**
+ * @brief Decodes a COBS frame received without its delimiter.
+ *
+ * @param in The encoded bytes, which may be the same buffer as out.
+ * @param length Number of encoded bytes.
+ * @param out Decoded bytes.
+ * @return Number of decoded bytes, 0 if the frame is malformed.
+ */
+size_t cobsDecode(const uint8_t *in, size_t length, uint8_t *out);
+
+/**
+ * @brief A packet received from the host.
+ *
+ * The payload is a view into the decoder buffer, valid until the next byte is pushed.
+ */
+struct Packet
+{
+    uint8_t seq;            ///< Sequence number chosen by the host.
+    uint8_t opcode;         ///< Command event letter or PacketOpcode.
+    const uint8_t *payload; ///< First byte of the payload.
+    uint8_t length;         ///< Number of payload bytes.
+};
+
+/**
+ * @brief Reassembles and checks the packets received on the serial port.
+ */
+class PacketDecoder
+{
+public:
+    /**
+     * @brief Appends a received byte to the current frame.
+     *
+     * @param c The received byte.
+     * @param packet Filled when the byte completes a valid packet.
+     * @return true if a packet was completed.
+     */
+    bool push(uint8_t c, Packet &packet);
+
+    /**
+     * @brief Number of frames dropped because they were too long, malformed or failed the CRC.
+     */
+    uint32_t errorCount() const { return errors; }
+
+private:
+    uint8_t frame[PACKET_MAX_FRAME]; ///< Bytes of the frame being received, decoded in place.
+    uint8_t length = 0;              ///< Number of bytes in frame.
+    bool overflow = false;           ///< Set while skipping the rest of an overlong frame.
+    uint32_t errors = 0;             ///< Number of frames dropped.
+};
+
+/**
+ * @brief Encodes and sends a packet.
+ *
+ * @param out Where to write the frame.
+ * @param seq Sequence number.
+ * @param opcode Opcode.
+ * @param payload Payload bytes.
+ * @param length Number of payload bytes, at most PACKET_MAX_PAYLOAD.
+ */
+void sendPacket(Print &out, uint8_t seq, uint8_t opcode, const uint8_t *payload, uint8_t length);
+
+/**
+ * @brief Output of the firmware messages, in the format of the current protocol.
+ *
+ * In text mode the bytes go straight to Serial. In binary mode each line is collected and sent as
+ * an OP_TEXT packet once its newline is written.
+ */
+class ConsolePrint : public Print
+{
+public:
+    /**
+     * @brief Selects the protocol, a line being collected is dropped.
+     * @param enabled Whether the binary protocol is used.
+     */
+    void setBinary(bool enabled);
+
+    /**
+     * @brief Whether the binary protocol is used.
+     */
+    bool binary() const { return binaryMode; }
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *buffer, size_t size) override;
+    using Print::write;
+
+private:
+    bool binaryMode = false;               ///< Whether the binary protocol is used.
+    uint8_t line[PACKET_MAX_PAYLOAD];      ///< Line being collected in binary mode.
+    uint8_t lineLength = 0;                ///< Number of bytes in line.
+};
+
+/**
+ * @brief Global output of the firmware messages.
+ */
+extern ConsolePrint console;
+
+#endif // BINARYPROTOCOL_H
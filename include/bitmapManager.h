@@ -29,6 +29,9 @@
  * This file contains functions to draw various bitmaps and screens on an OLED display
  * using the HT_SSD1306Wire library. The functions include drawing logos, loading screens,
  * and different status screens.
+ *
+ * The status screens are composed from a table of layers, see bitmapManager.cpp. drawLogo() only
+ * draws into the buffer, the other functions render a whole screen and send it.
  */
 
 #ifndef BITMAPMANAGER_H
@@ -39,7 +42,6 @@
 #include "HT_SSD1306Wire.h"
 #endif
 #include <Wire.h>
-#include "images.h"
 #include "display.h" // Include display.h to use the display object
 #include "ledStatus.h"
 #include "firmware_config.h"
@@ -50,34 +52,26 @@
 void drawLogo();
 
 /**
- * @brief Displays the loading screen during initialization.
- */
-void loadingScreen();
-
-/**
- * @brief Draws the top frame on the OLED display.
+ * @brief Draws the logo and the controller version and sends them to the display, without waiting.
  */
-void topFrame();
+void drawLoadingScreen();
 
 /**
- * @brief Draws the bottom frame on the OLED display.
- */
-void bottomFrame();
-
-/**
- * @brief Displays the main screen on the OLED display.
+ * @brief Displays the loading screen during initialization.
  */
-void mainScreen();
+void loadingScreen();
 
 /**
  * @brief Displays the joystick screen on the OLED display.
+ * @param nbPlayers Number of connected joysticks, clamped to 0-4.
  */
-void joystickScreen();
+void joystickScreen(int nbPlayers);
 
 /**
- * @brief Displays the status screen on the OLED display.
+ * @brief Displays the status screen with a progress bar.
+ * @param progress The progress in percent.
  */
-void statusScreen();
+void progressScreen(uint8_t progress);
 
 /**
  * @brief Displays the waiting screen on the OLED display.
@@ -104,4 +98,11 @@ void stoppingScreen();
  */
 void stoppedScreen();
 
+/**
+ * @brief Forgets the screen held by the frame buffer, the next screen is drawn in full.
+ *
+ * To call when the frame buffer has been drawn by other means than the functions above.
+ */
+void invalidateScreen();
+
 #endif // BITMAPMANAGER_H
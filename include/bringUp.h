@@ -0,0 +1,67 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file bringUp.h
+ * @brief Header file for the non-blocking joystick bring-up sequence.
+ *
+ * When the frontend sends the ESP32? handshake, the joysticks and their button LEDs are reconnected
+ * one after the other. This sequence is driven by timers from the main loop so serial commands keep
+ * being answered while the relays settle, and the progress is reported to the host.
+ */
+
+#ifndef BRINGUP_H
+#define BRINGUP_H
+
+#include <Arduino.h>
+
+/** @brief Delay between the joystick relay and the LED relay of a joystick, in milliseconds. */
+const unsigned long BRINGUP_RELAY_DELAY_MS = 1000;
+
+/** @brief Delay between the LED relay of a joystick and the next joystick, in milliseconds. */
+const unsigned long BRINGUP_SETTLE_DELAY_MS = 2000;
+
+/**
+ * @brief Starts the joystick bring-up sequence.
+ *
+ * Called by the controller on the handshake. Does nothing if the sequence is already running.
+ */
+void startBringUp();
+
+/**
+ * @brief Checks whether the joystick bring-up sequence is running.
+ */
+bool bringUpRunning();
+
+/**
+ * @brief Runs the bring-up steps that are due.
+ *
+ * Each joystick is reported to the host with an INIT:<n> line once connected. At the end the
+ * controller receives EV_BRINGUP_DONE and INIT:DONE is sent.
+ *
+ * @return Time until the next step in milliseconds, portMAX_DELAY if the sequence is not running.
+ */
+uint32_t serviceBringUp();
+
+#endif // BRINGUP_H
@@ -0,0 +1,121 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file commandParser.h
+ * @brief Header file for the allocation-free serial command parser.
+ *
+ * Incoming serial bytes are stored in a fixed-size ring buffer. Complete lines are returned
+ * as views pointing directly into that buffer, so parsing a command never touches the heap.
+ */
+
+#ifndef COMMANDPARSER_H
+#define COMMANDPARSER_H
+
+#include <Arduino.h>
+
+/**
+ * @brief A single command line received on the serial port.
+ *
+ * The text is a view into the parser ring buffer (not NUL terminated). It stays valid until
+ * the next byte is pushed into the parser.
+ */
+struct Command
+{
+    const char *text; ///< First character of the trimmed line.
+    uint8_t length;   ///< Number of characters in the trimmed line.
+    char event;       ///< First character of the line, or 0 for an empty line.
+    int value;        ///< Integer following the ':' separator (0 when missing).
+    int16_t seq;      ///< Sequence number of the binary packet carrying the command, -1 for a text line.
+
+    /**
+     * @brief Fills the command from a line of text, which must outlive the command.
+     *
+     * @param line First character of the line.
+     * @param lineLength Number of characters in the line, without the newline.
+     */
+    void parse(const char *line, uint16_t lineLength);
+
+    /**
+     * @brief Checks whether the command text is exactly the given string.
+     *
+     * @param str NUL terminated string to compare with.
+     * @return true if the command matches the string.
+     */
+    bool equals(const char *str) const;
+};
+
+/**
+ * @brief Line parser working on a fixed-size mirrored ring buffer.
+ *
+ * Every byte is written twice, at its ring index and RING_SIZE bytes further. Any window of up
+ * to RING_SIZE bytes is therefore contiguous in memory, which lets lines that wrap around the
+ * end of the ring be returned as plain pointer/length views.
+ */
+class CommandParser
+{
+public:
+    static const uint16_t RING_SIZE = 128; ///< Ring capacity in bytes, must be a power of two.
+
+    /**
+     * @brief Appends a received byte to the ring.
+     *
+     * If the line being received grows longer than the ring it is discarded up to the next
+     * newline. Complete lines are never overwritten: when they fill the ring the byte is refused
+     * and must be pushed again once they have been taken out with next().
+     *
+     * @param c The received byte.
+     * @return false if the byte was refused because the ring is full of unread lines.
+     */
+    bool push(char c);
+
+    /**
+     * @brief Extracts the next complete line from the ring.
+     *
+     * @param cmd Command filled with a view of the line.
+     * @return true if a line was available.
+     */
+    bool next(Command &cmd);
+
+    /**
+     * @brief Checks whether bytes of an unterminated line are waiting in the ring.
+     */
+    bool hasPartialLine() const { return head != scan; }
+
+    /**
+     * @brief Number of lines dropped because they did not fit in the ring.
+     */
+    uint32_t overflowCount() const { return overflows; }
+
+private:
+    char ring[RING_SIZE * 2];  ///< Mirrored storage.
+    uint16_t head = 0;         ///< Write index (free running).
+    uint16_t tail = 0;         ///< Start of the oldest unread line (free running).
+    uint16_t scan = 0;         ///< Position just after the last newline seen.
+    uint8_t pendingLines = 0;  ///< Number of complete lines between tail and scan.
+    bool discarding = false;   ///< Set while skipping the rest of an overlong line.
+    uint32_t overflows = 0;    ///< Number of overlong lines dropped.
+};
+
+#endif // COMMANDPARSER_H
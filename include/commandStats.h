@@ -0,0 +1,108 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file commandStats.h
+ * @brief Header file for the per-command latency histograms.
+ *
+ * Each command handled by the controller gets a context holding its type and the time of the UART
+ * receive event that brought it. The stages of its handling (acknowledgement sent, relays written,
+ * frame transferred to the panel) are then timed from that instant and counted in fixed-size
+ * histograms with power of two buckets, one per command type and stage. Recording a stage is a
+ * timer read and a few integer operations, so the statistics stay enabled in production builds.
+ */
+
+#ifndef COMMANDSTATS_H
+#define COMMANDSTATS_H
+
+#include <Arduino.h>
+
+/**
+ * @enum StatsStage
+ * @brief Stages of the handling of a command.
+ */
+enum StatsStage
+{
+    STAGE_ACK,   ///< Acknowledgement written to the serial port.
+    STAGE_RELAY, ///< LED relays written.
+    STAGE_FRAME, ///< Frame transfer to the panel completed.
+    STAGE_COUNT
+};
+
+/** @brief Number of histogram buckets, bucket n counts the latencies from 2^n to 2^(n+1)-1 us. */
+const uint8_t STATS_BUCKETS = 24;
+
+/** @brief Command type of a context not attached to any command. */
+const uint8_t STATS_NO_COMMAND = 0xFF;
+
+/**
+ * @brief Command whose stages are being timed.
+ */
+struct StatsContext
+{
+    uint8_t command; ///< ControllerEvent of the command, STATS_NO_COMMAND for none.
+    int64_t start;   ///< Time of the UART receive event of the command, in microseconds.
+};
+
+/**
+ * @brief Starts timing a command received with the last UART receive event.
+ * @param command ControllerEvent of the command.
+ */
+void statsBeginCommand(uint8_t command);
+
+/**
+ * @brief Stops attaching the following stages to the last command.
+ */
+void statsEndCommand();
+
+/**
+ * @brief Context of the command being handled, to time a stage completed later by another task.
+ */
+StatsContext statsContext();
+
+/**
+ * @brief Records a stage of the command being handled.
+ * @param stage The stage completed.
+ */
+void statsRecord(StatsStage stage);
+
+/**
+ * @brief Records a stage of a command.
+ *
+ * @param context Context of the command, nothing is recorded for STATS_NO_COMMAND.
+ * @param stage The stage completed.
+ */
+void statsRecord(const StatsContext &context, StatsStage stage);
+
+/**
+ * @brief Prints the histograms that are not empty, then STATS:END.
+ */
+void printCommandStats();
+
+/**
+ * @brief Empties all histograms.
+ */
+void resetCommandStats();
+
+#endif // COMMANDSTATS_H
@@ -0,0 +1,114 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file controller.h
+ * @brief Header file for the controller state machine.
+ *
+ * The controller goes through three states: waiting for the frontend handshake, reconnecting the
+ * joysticks, and ready. Every command and the end of the bring-up sequence are events fed to a
+ * compile time table giving, for each state and event, whether the event is accepted, the action to
+ * run and the next state. Screens, relays and the LED pattern are only changed by those actions and
+ * by the entry of a new state, and an event that is not valid in the current state is rejected with
+ * a single table lookup.
+ *
+ * The time spent in each state is accumulated from the transition timestamps and can be queried
+ * over serial.
+ */
+
+#ifndef CONTROLLER_H
+#define CONTROLLER_H
+
+#include <Arduino.h>
+
+/**
+ * @enum ControllerState
+ * @brief States of the controller.
+ */
+enum ControllerState
+{
+    STATE_WAITING, ///< Waiting for the ESP32? handshake, the LED plays the WAITING pattern.
+    STATE_CONFIG,  ///< Reconnecting the joysticks one after the other.
+    STATE_READY,   ///< Joysticks connected, player count updates are accepted.
+    STATE_COUNT
+};
+
+/**
+ * @enum ControllerEvent
+ * @brief Events fed to the controller.
+ */
+enum ControllerEvent
+{
+    EV_HANDSHAKE,    ///< ESP32? handshake from the frontend.
+    EV_BRINGUP_DONE, ///< All joysticks reconnected.
+    EV_PLAYERS,      ///< N, L or Q command with the number of players.
+    EV_STARTING,     ///< S command, a game is starting.
+    EV_STARTED,      ///< D command, a game has started.
+    EV_STOPPING,     ///< E command, a game is stopping.
+    EV_STOPPED,      ///< P command, a game has stopped.
+    EV_COUNT
+};
+
+/**
+ * @brief Gives the event of a command letter.
+ *
+ * @param event First character of the command.
+ * @return The event, EV_COUNT if the letter is not a controller command.
+ */
+ControllerEvent commandEvent(char event);
+
+/**
+ * @brief Checks whether an event is valid in the current state, without dispatching it.
+ * @param event The event.
+ */
+bool controllerAccepts(ControllerEvent event);
+
+/**
+ * @brief Feeds an event to the state machine.
+ *
+ * @param event The event.
+ * @param value Argument of the event, the number of players for EV_PLAYERS.
+ * @return false if the event is not valid in the current state, nothing is done then.
+ */
+bool controllerDispatch(ControllerEvent event, int value = 0);
+
+/**
+ * @brief Current state of the controller.
+ */
+ControllerState controllerState();
+
+/**
+ * @brief Renders the player count left by the last EV_PLAYERS event, if not done yet.
+ *
+ * Successive EV_PLAYERS events only record the number of players, so a burst of updates is shown
+ * with a single relay update and a single frame once this function is called.
+ */
+void flushPlayers();
+
+/**
+ * @brief Prints the time spent in each state and the number of rejected events, then restarts the statistics.
+ */
+void printStateStats();
+
+#endif // CONTROLLER_H
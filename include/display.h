@@ -36,19 +36,180 @@
 #include <Arduino.h>
 #include <U8g2lib.h>
 #include <Wire.h>
+#include "assetStore.h"
+#include "commandStats.h"
+
+#ifdef DISPLAY_PAGE_MODE
+/** @brief U8g2 class of the display: a single page buffer (128 bytes), frames drawn page by page. */
+typedef U8G2_SSD1306_128X64_NONAME_1_HW_I2C DisplayBase;
+#else
+/** @brief U8g2 class of the display: a full frame buffer (1 KB). */
+typedef U8G2_SSD1306_128X64_NONAME_F_HW_I2C DisplayBase;
+#endif
 
 /**
- * @brief CustomDisplay class derived from U8G2_SSD1306_128X64_NONAME_F_HW_I2C to add custom drawing functions.
+ * @brief Function drawing a whole screen, see CustomDisplay::render().
+ *
+ * It may be called several times for the same frame, so it only draws, with no other side effect.
  */
-class CustomDisplay : public U8G2_SSD1306_128X64_NONAME_F_HW_I2C
+typedef void (*DrawList)();
+
+/**
+ * @brief CustomDisplay class derived from the U8g2 SSD1306 class to add custom drawing functions.
+ *
+ * By default the display keeps a full frame buffer (U8G2_SSD1306_128X64_NONAME_F_HW_I2C). It also
+ * keeps a copy of the last frame sent to the panel, so that sendBuffer() only transfers the 8x8 tiles
+ * that changed over I2C.
+ *
+ * Once startRenderTask() has been called, the I2C transfers are done by a dedicated task on core 0.
+ * sendBuffer() then only copies the composed frame into a double buffer and returns. If a newer frame
+ * is submitted before the render task picked up the previous one, the previous one is dropped.
+ *
+ * Built with DISPLAY_PAGE_MODE, the display only holds one page (U8G2_SSD1306_128X64_NONAME_1_HW_I2C)
+ * and render() replays the draw list once per page. There is then no last frame copy, no double
+ * buffer and no render task: every frame is sent in full by the calling task.
+ */
+class CustomDisplay : public DisplayBase
 {
 public:
+    /** @brief Size of a frame in bytes (128x64 pixels, 1 bit per pixel). */
+    static const uint16_t FRAME_SIZE = 128 * 64 / 8;
+
     // Constructor matching the base class constructor
     CustomDisplay(const u8g2_cb_t *rotation, uint8_t reset, uint8_t clock, uint8_t data)
-        : U8G2_SSD1306_128X64_NONAME_F_HW_I2C(rotation, reset, clock, data) {}
+        : DisplayBase(rotation, reset, clock, data) {}
 
     // Method to draw a progress bar
     void drawProgressBar(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t progress);
+
+    /**
+     * @brief Draws an XBM bitmap, 8x8 blocks at a time in the default drawing state.
+     *
+     * Hides U8G2::drawXBMP(). With draw color 1 in solid bitmap mode the rows are transposed into
+     * page bytes with word operations, whole bytes being written when y is page aligned. Other drawing
+     * states fall back to U8G2::drawXBMP().
+     *
+     * @param x The X-coordinate of the left column.
+     * @param y The Y-coordinate of the top row.
+     * @param w The width of the bitmap in pixels.
+     * @param h The height of the bitmap in pixels.
+     * @param bitmap The XBM bitmap, in PROGMEM.
+     */
+    void drawXBMP(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap);
+
+    /**
+     * @brief Decodes a packed bitmap straight into the buffer.
+     *
+     * Same result as drawXBMP() in the default solid bitmap mode with draw color 1, without decoding
+     * the bitmap into a temporary copy. In page mode only the rows of the current page are written.
+     * ASSET_TILES bitmaps must be drawn at a page aligned y.
+     *
+     * @param x The X-coordinate of the left column.
+     * @param y The Y-coordinate of the top row.
+     * @param asset The bitmap, see assetStore.h.
+     */
+    void drawAsset(uint8_t x, uint8_t y, const PackedAsset &asset);
+
+    /**
+     * @brief Initializes the display, the next frame is sent in full.
+     */
+    bool begin();
+
+    /**
+     * @brief Creates the render task, which then owns all transfers to the panel.
+     */
+    void startRenderTask();
+
+    /**
+     * @brief Draws a screen on a blank frame and sends it to the panel.
+     *
+     * In full buffer mode the draw list runs once, then the frame goes through sendBuffer(). In page
+     * mode it runs once per page, each page being sent as soon as it is drawn.
+     *
+     * @param draw The draw list, NULL for a blank screen.
+     */
+    void render(DrawList draw);
+
+#ifndef DISPLAY_PAGE_MODE
+    /**
+     * @brief Sends the tiles of the buffer that differ from the last frame sent.
+     *
+     * Hides U8G2::sendBuffer() so every screen only pushes its changes over I2C. When the render task
+     * runs, the frame is handed over to it and the call returns without waiting for the transfer.
+     */
+    void sendBuffer();
+
+    /**
+     * @brief Forces the next frame to be sent in full.
+     */
+    void invalidate() { lastFrameValid = false; }
+#else
+    /**
+     * @brief Every frame is sent in full in page mode, nothing to do.
+     */
+    void invalidate() {}
+#endif
+
+    /** @brief Number of frames sent. */
+    uint32_t frameCount() const { return frames; }
+
+    /** @brief Number of frames replaced by a newer one before being sent. */
+    uint32_t droppedFrames() const { return dropped; }
+
+    /** @brief Number of frame bytes transferred over I2C. */
+    uint32_t busBytes() const { return bytesSent; }
+
+    /** @brief Number of display area transfers issued. */
+    uint32_t busTransfers() const { return transfers; }
+
+    /** @brief Duration of the last frame transfer, in microseconds. */
+    uint32_t lastFrameTime() const { return lastFrameUs; }
+
+    /** @brief Cumulated duration of all frame transfers, in microseconds. */
+    uint32_t totalFrameTime() const { return totalFrameUs; }
+
+private:
+    /** @brief Bytes of a row of drawStrip(), enough for the display width. */
+    static const uint8_t STRIP_BYTES = 128 / 8;
+
+    /**
+     * @brief Writes up to 8 XBM rows into the buffer as page bytes.
+     *
+     * @param x The X-coordinate of the left column.
+     * @param top The Y-coordinate of the first row.
+     * @param width The number of columns to write, x + width within the display.
+     * @param rowMask The rows to write, bit i for row i.
+     * @param strip The rows, STRIP_BYTES bytes apart.
+     */
+    void drawStrip(uint8_t x, int top, uint8_t width, uint8_t rowMask, const uint8_t (*strip)[STRIP_BYTES]);
+
+#ifndef DISPLAY_PAGE_MODE
+    /**
+     * @brief Sends the tiles of a frame that differ from the last frame sent.
+     * @param frame The frame to send, in the U8g2 buffer layout.
+     */
+    void flushFrame(const uint8_t *frame);
+
+    /**
+     * @brief Render task function, flushes the submitted frames.
+     * @param pvParameters Pointer to the CustomDisplay instance.
+     */
+    static void renderTask(void *pvParameters);
+
+    uint8_t lastFrame[FRAME_SIZE];      ///< Copy of the frame last sent to the panel.
+    volatile bool lastFrameValid = false; ///< Whether lastFrame matches the panel content.
+    uint8_t frameBuffers[2][FRAME_SIZE]; ///< Frames handed over to the render task.
+    volatile int8_t pendingIndex = -1;  ///< Buffer holding the frame to send next, -1 if none.
+    volatile int8_t flushingIndex = -1; ///< Buffer being sent by the render task, -1 if none.
+    StatsContext frameContexts[2];      ///< Command that produced the frame of each buffer.
+    TaskHandle_t renderTaskHandle = NULL; ///< Handle of the render task, NULL until started.
+#endif
+    volatile uint32_t frames = 0;       ///< Number of frames sent.
+    volatile uint32_t dropped = 0;      ///< Number of frames dropped.
+    volatile uint32_t bytesSent = 0;    ///< Number of frame bytes transferred.
+    volatile uint32_t transfers = 0;    ///< Number of display area transfers.
+    volatile uint32_t lastFrameUs = 0;  ///< Duration of the last frame.
+    volatile uint32_t totalFrameUs = 0; ///< Cumulated duration of all frames.
 };
 
 /**
@@ -4,8 +4,21 @@
 
 const char CONTROLLER_VERSION[] = "v1.2.0";
 
+//===============================
+// BOOT.
+// With FAST_BOOT all relays are released at once and the logo is only shown for as long as the relays
+// need to settle, while serial, LED and display are initialized.
+// Set FAST_BOOT to false to get back the staggered relay release and the 10 seconds logo.
+const bool FAST_BOOT = true;
+const unsigned long RELAY_SETTLE_MS = 500; // Time for the relays to release and the USB boards to drop
+
 //===============================
 // USED PINS.
+// Same value as in U8x8lib.h, so that the pin table does not need the display library
+#ifndef U8X8_PIN_NONE
+#define U8X8_PIN_NONE 255
+#endif
+
 // Some pins should be avoided as they are used by builtin features like on board OLED screen.
 // This pin list is safe, some other will work as well but you can run into an issue where ESPTOOL won't be able to
 // flash the ESP.
@@ -47,4 +60,22 @@ const int RELAY[8] = {RELAY1, RELAY2, RELAY3, RELAY4, RELAY5, RELAY6, RELAY7, RE
 // Pin definitions
 const int ledPin = 2; // LED connected to GPIO pin
 #endif
+
+// Native host build, same pins as the DevKit
+#ifdef NATIVE
+const int I2CSDA = 21;
+const int I2CSCL = 22;
+const int I2CRESET = U8X8_PIN_NONE;
+const int RELAY1 = 15;
+const int RELAY2 = 2;
+const int RELAY3 = 4;
+const int RELAY4 = 16;
+const int RELAY5 = 17;
+const int RELAY6 = 5;
+const int RELAY7 = 18;
+const int RELAY8 = 19;
+const int RELAY[8] = {RELAY1, RELAY2, RELAY3, RELAY4, RELAY5, RELAY6, RELAY7, RELAY8};
+// Pin definitions
+const int ledPin = 2; // LED connected to GPIO pin
+#endif
 #endif
\ No newline at end of file
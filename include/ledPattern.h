@@ -0,0 +1,183 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file ledPattern.h
+ * @brief Header file for the LED pattern engine.
+ *
+ * A blink pattern is a short table of segments, each holding the LED level for a duration, or fading
+ * to it. The table is looped forever by the output backend. On the ESP32 the RMT peripheral plays it
+ * in loop mode, so the LED blinks without any CPU time, a fade switching level at its middle. With
+ * -DLED_PATTERN_LEDC in the build flags the LEDC PWM peripheral plays it instead, ramping the fades
+ * for breathing patterns at the cost of one task wakeup per segment. The mock backend used for host
+ * builds records the pattern and computes the level from the time elapsed since it was started.
+ */
+
+#ifndef LEDPATTERN_H
+#define LEDPATTERN_H
+
+#include <Arduino.h>
+#include <atomic>
+
+/**
+ * @brief Part of a pattern with a fixed LED level, or a fade to it.
+ */
+struct LedSegment
+{
+    uint8_t level;       ///< LED level, HIGH or LOW.
+    uint16_t durationMs; ///< Duration of the segment in milliseconds.
+    bool fade;           ///< Ramp from the level of the previous segment over the duration.
+};
+
+/**
+ * @brief Table of segments looped forever. A single segment keeps the LED steady.
+ */
+struct LedPattern
+{
+    const LedSegment *segments; ///< Segments in playing order.
+    uint8_t count;              ///< Number of segments, at least 1.
+};
+
+/**
+ * @brief Gives the LED level of a pattern at a given time.
+ *
+ * A fade is seen as a switch to its level at the middle of its segment, as backends without PWM play it.
+ *
+ * @param pattern The pattern.
+ * @param elapsedMs Time since the pattern was started, in milliseconds.
+ * @return The LED level, HIGH or LOW.
+ */
+uint8_t ledPatternLevel(const LedPattern &pattern, uint32_t elapsedMs);
+
+/**
+ * @brief Prints the level changes of a pattern over a time window.
+ *
+ * Output format: <name>:0=<level>,<ms>=<level>,... with one entry per level change, written
+ * <ms>~<level> for a fade to level starting at ms.
+ *
+ * @param name Name printed before the trace.
+ * @param pattern The pattern.
+ * @param windowMs Length of the time window in milliseconds.
+ * @param out Where to print the trace.
+ */
+void printLedPatternTrace(const char *name, const LedPattern &pattern, uint32_t windowMs, Print &out);
+
+/**
+ * @brief Output stage playing the patterns on the LED.
+ */
+class LedPatternBackend
+{
+public:
+    virtual ~LedPatternBackend() {}
+
+    /**
+     * @brief Configures the LED pin.
+     * @param pin The GPIO number.
+     */
+    virtual void begin(int pin) = 0;
+
+    /**
+     * @brief Starts looping a pattern, replacing the current one.
+     * @param pattern The pattern, it must stay valid while it is played.
+     */
+    virtual void play(const LedPattern &pattern) = 0;
+};
+
+#ifdef ARDUINO_ARCH_ESP32
+/**
+ * @brief Backend looping the pattern with the RMT peripheral.
+ *
+ * Each RMT item holds two segments. Segments longer than an RMT item can hold are split, and an odd
+ * number of segments gets its last segment split in two halves, since a zero duration would end the loop.
+ */
+class RmtLedPatternBackend : public LedPatternBackend
+{
+public:
+    static const uint8_t MAX_ITEMS = 32;   ///< RMT items available for a pattern.
+    static const uint32_t TICK_NS = 100000; ///< Requested RMT tick, 100 us.
+
+    void begin(int pin) override;
+    void play(const LedPattern &pattern) override;
+
+private:
+    rmt_obj_t *rmt = NULL;                 ///< RMT channel of the LED.
+    float tickNs = TICK_NS;                ///< Tick obtained from the RMT clock dividers.
+    rmt_data_t items[MAX_ITEMS];           ///< Pattern converted to RMT items.
+};
+
+#ifdef LED_PATTERN_LEDC
+/**
+ * @brief Backend playing the pattern with the LEDC PWM peripheral, fades included.
+ *
+ * A task starts each segment, fades through the LEDC fade engine, then sleeps until the next one. A
+ * steady pattern costs no wakeup, a blinking or breathing one costs one per segment.
+ */
+class LedcLedPatternBackend : public LedPatternBackend
+{
+public:
+    static const uint8_t CHANNEL = 0;       ///< LEDC channel of the LED.
+    static const uint32_t FREQUENCY = 5000; ///< PWM frequency in Hz.
+    static const uint8_t RESOLUTION = 8;    ///< PWM resolution in bits.
+
+    void begin(int pin) override;
+    void play(const LedPattern &pattern) override;
+
+private:
+    std::atomic<const LedPattern *> pattern{NULL}; ///< Pattern to play, written by play().
+    TaskHandle_t task = NULL;                      ///< Task playing the segments.
+
+    /**
+     * @brief Task function, plays the segments of the current pattern until a new one is notified.
+     * @param pvParameters Pointer to the LedcLedPatternBackend instance.
+     */
+    static void playTask(void *pvParameters);
+};
+#endif
+#endif
+
+/**
+ * @brief Backend recording the pattern and its start time, for host builds.
+ */
+class MockLedPatternBackend : public LedPatternBackend
+{
+public:
+    const LedPattern *pattern = NULL; ///< Pattern being played.
+    unsigned long startMs = 0;        ///< Value of millis() when the pattern was started.
+    uint32_t plays = 0;               ///< Number of patterns started.
+
+    void begin(int pin) override;
+    void play(const LedPattern &pattern) override;
+
+    /**
+     * @brief Current level of the LED.
+     */
+    uint8_t level() const { return pattern ? ledPatternLevel(*pattern, millis() - startMs) : LOW; }
+};
+
+/**
+ * @brief Global backend driving the status LED.
+ */
+extern LedPatternBackend &ledPatterns;
+
+#endif // LEDPATTERN_H
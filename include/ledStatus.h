@@ -28,11 +28,11 @@
  *
  * This file contains the definitions and function prototypes required to manage an LED connected to a GPIO pin.
  * The LED can be in one of four states: OFF, READY, WAITING, or CONFIG, each causing different behavior in the LED.
- * The management of the LED state is handled by FreeRTOS tasks to ensure efficient multitasking.
+ * The blink pattern of each state is a table of segments played by the LED pattern engine (ledPattern.h).
  *
- * The tasks defined in this file include:
- * - manageLED: Controls the LED behavior based on the current status.
- * - setupLED: Initializes the LED pin, serial communication, and creates the FreeRTOS tasks.
+ * The functions defined in this file include:
+ * - setLedStatus: Changes the current status and starts its blink pattern.
+ * - setupLED: Initializes the LED pattern engine and serial communication.
  * - activateLeds: Activates LEDs based on the number of players.
  */
 
@@ -44,9 +44,10 @@
 #include "HT_SSD1306Wire.h"
 #endif
 #include <Wire.h>
-#include "images.h"
+#include <atomic>
 #include "display.h" // Include display.h to use the display object
 #include "firmware_config.h"
+#include "ledPattern.h"
 
 /**
  * @enum LedStatus
@@ -66,35 +67,37 @@ enum LedStatus
     CONFIG
 };
 
-extern int joyPos[4];                    ///< Positions of the joysticks on the display
-extern volatile LedStatus currentStatus; ///< Current status of the LED.
-extern TaskHandle_t Task1;               ///< Handle for the LED management task.
+extern std::atomic<LedStatus> currentStatus; ///< Current status of the LED, change it with setLedStatus().
+extern const LedPattern LED_PATTERNS[];  ///< Blink pattern of each status, indexed by LedStatus.
 
 /**
- * @brief Task function to manage the LED behavior based on the current status.
+ * @brief Changes the LED status and starts its blink pattern.
  *
- * This function runs in an infinite loop, checking the current status of the LED and
- * updating its state accordingly. The behavior of the LED changes depending on the value of currentStatus.
- *
- * @param pvParameters Pointer to the parameters passed to the task (not used in this case).
+ * @param status The new LED status.
  */
-void manageLED(void *pvParameters);
+void setLedStatus(LedStatus status);
+
+/**
+ * @brief Prints the status changes and the time taken to start their pattern, then restarts the statistics.
+ */
+void printLedStats();
 
 /**
  * @brief Activates LEDs based on the number of players.
  *
  * @param nbPlayers The number of players.
- * @param showStatus Whether to show the status on the display.
  */
-void activateLeds(int nbPlayers, bool showStatus = true);
+void activateLeds(int nbPlayers);
 
 /**
- * @brief Initializes the LED pin, serial communication, and creates the FreeRTOS tasks.
+ * @brief Initializes the LED pattern backend and serial communication.
  */
 void setupLED();
 
 /**
  * @brief Physically disconnect all joysticks
+ *
+ * @param staggered Whether to release the relays two by two, 500 ms apart, instead of all at once.
  */
-void disconnectAllRelays();
+void disconnectAllRelays(bool staggered = true);
 #endif // LEDSTATUS_H
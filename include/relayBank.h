@@ -0,0 +1,172 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file relayBank.h
+ * @brief Header file for the relay bank driver.
+ *
+ * The relay bank keeps a shadow bitmask of the state of the 8 relays. A new target state is compared
+ * with the shadow and only the relays that actually change are written, with a single set and a single
+ * clear register write per GPIO bank. The register access goes through a backend so the driver can run
+ * on a mock when the firmware is built for the host.
+ */
+
+#ifndef RELAYBANK_H
+#define RELAYBANK_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Output stage used by the relay bank to drive the GPIOs.
+ */
+class RelayBackend
+{
+public:
+    virtual ~RelayBackend() {}
+
+    /**
+     * @brief Configures a pin as output.
+     * @param pin The GPIO number.
+     */
+    virtual void configure(int pin) = 0;
+
+    /**
+     * @brief Sets and clears GPIOs of a bank in one go.
+     *
+     * @param bank GPIO bank, 0 for GPIO 0-31 and 1 for GPIO 32 and above.
+     * @param setMask Bits of the GPIOs to drive HIGH.
+     * @param clearMask Bits of the GPIOs to drive LOW.
+     */
+    virtual void write(uint8_t bank, uint32_t setMask, uint32_t clearMask) = 0;
+};
+
+/**
+ * @brief Backend writing the ESP32 GPIO set/clear registers (out_w1ts/out_w1tc).
+ */
+class GpioRelayBackend : public RelayBackend
+{
+public:
+    void configure(int pin) override;
+    void write(uint8_t bank, uint32_t setMask, uint32_t clearMask) override;
+};
+
+/**
+ * @brief Backend recording the GPIO levels and counting the register writes, for host builds.
+ */
+class MockRelayBackend : public RelayBackend
+{
+public:
+    uint32_t level[2] = {0, 0};    ///< Current level of the GPIOs of each bank.
+    uint32_t registerWrites = 0;   ///< Number of set or clear register writes.
+    unsigned long lastWriteUs = 0; ///< Value of micros() at the last write.
+
+    void configure(int pin) override;
+    void write(uint8_t bank, uint32_t setMask, uint32_t clearMask) override;
+
+    /**
+     * @brief Reads the level of a GPIO.
+     * @param pin The GPIO number.
+     */
+    bool read(int pin) const { return (level[pin >> 5] >> (pin & 31)) & 1; }
+};
+
+/**
+ * @brief Driver for the relays, applying state changes as batched register writes.
+ *
+ * Relays are identified by their index in the pin table, bit n of a mask being relay n.
+ */
+class RelayBank
+{
+public:
+    /**
+     * @brief Builds the relay bank.
+     *
+     * @param pins Table of the relay GPIOs, up to 8.
+     * @param count Number of relays in the table.
+     * @param backend Output stage driving the GPIOs.
+     */
+    RelayBank(const int *pins, uint8_t count, RelayBackend &backend);
+
+    /**
+     * @brief Configures the relay pins as outputs.
+     *
+     * The shadow state is invalidated, each relay is written the next time it is updated.
+     */
+    void begin();
+
+    /**
+     * @brief Drives all relays to the given state, writing only the ones that change.
+     * @param target Bitmask of the relays to turn on.
+     */
+    void apply(uint8_t target);
+
+    /**
+     * @brief Drives a subset of the relays, leaving the others untouched.
+     *
+     * @param mask Bitmask of the relays to update.
+     * @param values Bitmask of the relays to turn on, among the ones of mask.
+     */
+    void update(uint8_t mask, uint8_t values);
+
+    /**
+     * @brief Turns a single relay on or off.
+     *
+     * @param relay Index of the relay in the pin table.
+     * @param on Whether to turn the relay on.
+     */
+    void set(uint8_t relay, bool on) { update(1 << relay, on ? 1 << relay : 0); }
+
+    /**
+     * @brief Returns the bitmask of the relays currently on.
+     */
+    uint8_t state() const { return shadow; }
+
+    /**
+     * @brief Number of register writes issued since boot.
+     */
+    uint32_t writeCount() const { return writes; }
+
+private:
+    const int *pins;        ///< Relay GPIOs.
+    uint8_t count;          ///< Number of relays.
+    RelayBackend &backend;  ///< Output stage.
+    uint8_t shadow = 0;     ///< Last state written to the relays.
+    uint8_t known = 0;      ///< Relays whose shadow bit reflects the real GPIO level.
+    uint32_t writes = 0;    ///< Number of register writes.
+
+    /**
+     * @brief Writes the relays of a subset that differ from the target or are not known yet.
+     *
+     * @param mask Bitmask of the relays to update.
+     * @param target Bitmask of the relays to turn on, among the ones of mask.
+     */
+    void write(uint8_t mask, uint8_t target);
+};
+
+/**
+ * @brief Global relay bank driving the RELAY table of firmware_config.h.
+ */
+extern RelayBank relays;
+
+#endif // RELAYBANK_H
@@ -0,0 +1,76 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file serialReceiver.h
+ * @brief Header file for the event-driven serial receive path.
+ *
+ * Instead of polling Serial.available(), the main loop task sleeps until the UART driver reports
+ * received data through its onReceive callback. The time spent sleeping and the delay between the
+ * reception of a line and its dispatch are measured and can be queried over serial.
+ */
+
+#ifndef SERIALRECEIVER_H
+#define SERIALRECEIVER_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Registers the UART receive callback waking up the calling task.
+ *
+ * Must be called from the task running loop(), after Serial.begin().
+ */
+void setupSerialReceiver();
+
+/**
+ * @brief Blocks the calling task until serial data is received or the timeout expires.
+ *
+ * The time spent blocked is accounted as idle time.
+ *
+ * @param timeoutMs Maximum time to wait in milliseconds, portMAX_DELAY to wait forever.
+ * @return true if woken up by received data.
+ */
+bool waitForSerial(uint32_t timeoutMs);
+
+/**
+ * @brief Records the dispatch of a command received after the last UART event.
+ */
+void markDispatch();
+
+/**
+ * @brief Time of the last UART receive event, in microseconds (esp_timer_get_time() time base).
+ */
+int64_t rxEventTimestamp();
+
+/**
+ * @brief Records a command superseded by a later one of the same batch, which was not rendered.
+ */
+void markCoalesced();
+
+/**
+ * @brief Prints the idle time and receive-to-dispatch latency statistics, then restarts them.
+ */
+void printRxStats();
+
+#endif // SERIALRECEIVER_H
@@ -0,0 +1,111 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file spscQueue.h
+ * @brief Lock-free single-producer/single-consumer queue for passing data between tasks.
+ *
+ * The queue is a fixed-size ring of slots indexed by two free running counters. Only the producer
+ * writes head and only the consumer writes tail. The producer publishes a slot with a release
+ * store of head, which the consumer reads with an acquire load before reading the slot. The consumer
+ * releases the slot the same way through tail. Both tasks can therefore run on different cores
+ * without any lock or critical section, and push() can be called from an ISR or a callback.
+ */
+
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <atomic>
+#include <stddef.h>
+
+/**
+ * @brief Fixed capacity lock-free single-producer/single-consumer queue.
+ *
+ * @tparam T Type of the elements, copied in and out of the queue.
+ * @tparam CAPACITY Number of slots, must be a power of two.
+ */
+template <typename T, size_t CAPACITY>
+class SpscQueue
+{
+    static_assert(CAPACITY >= 2 && (CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of two");
+
+public:
+    /**
+     * @brief Appends an element, producer side only.
+     *
+     * @param value The element to append.
+     * @return false if the queue is full, the element is then dropped.
+     */
+    bool push(const T &value)
+    {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) == CAPACITY)
+        {
+            return false;
+        }
+        slots[h & (CAPACITY - 1)] = value;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Removes the oldest element, consumer side only.
+     *
+     * @param value Filled with the element removed.
+     * @return false if the queue is empty.
+     */
+    bool pop(T &value)
+    {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (head.load(std::memory_order_acquire) == t)
+        {
+            return false;
+        }
+        value = slots[t & (CAPACITY - 1)];
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Checks whether the queue is empty, exact on the consumer side.
+     */
+    bool empty() const { return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Number of elements in the queue, exact on neither side while the other one is running.
+     */
+    size_t size() const { return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Number of slots of the queue.
+     */
+    static constexpr size_t capacity() { return CAPACITY; }
+
+private:
+    T slots[CAPACITY];                ///< Storage of the elements.
+    std::atomic<size_t> head{0};      ///< Number of elements pushed, written by the producer.
+    std::atomic<size_t> tail{0};      ///< Number of elements popped, written by the consumer.
+};
+
+#endif // SPSCQUEUE_H
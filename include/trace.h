@@ -0,0 +1,100 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file trace.h
+ * @brief Header file for the in-RAM event trace.
+ *
+ * Relay transitions, screen changes, frame transfers, state changes and command dispatch are
+ * recorded as fixed-size binary records in a ring buffer, always on. Recording claims a slot with a
+ * single atomic increment and writes 8 bytes, without lock, so any task can record and the timing
+ * of the firmware is not changed the way serial logging changes it. The ring is dumped on demand
+ * with the TRACE? command, and tools/traceDecode.py turns the dump into a Chrome trace timeline.
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <Arduino.h>
+
+/**
+ * @enum TraceEvent
+ * @brief Kinds of trace records, with the meaning of their arguments.
+ */
+enum TraceEvent
+{
+    TRACE_COMMAND = 1,     ///< Command dispatched, arg8: event letter (H for the handshake), arg16: value.
+    TRACE_ACK = 2,         ///< Command answered, arg8: event letter, arg16: 1 if accepted, 0 if refused.
+    TRACE_RELAYS = 3,      ///< Relays written, arg8: new relay state, arg16: relays that changed.
+    TRACE_SCREEN = 4,      ///< Screen drawn, arg8: TraceScreen.
+    TRACE_FRAME_BEGIN = 5, ///< Frame transfer to the panel started.
+    TRACE_FRAME_END = 6,   ///< Frame transfer completed, arg16: bytes sent.
+    TRACE_STATE = 7        ///< Controller state entered, arg8: ControllerState.
+};
+
+/**
+ * @enum TraceScreen
+ * @brief Screens reported by TRACE_SCREEN records.
+ */
+enum TraceScreen
+{
+    SCREEN_LOADING,  ///< Logo and version.
+    SCREEN_WAITING,  ///< Waiting for the frontend.
+    SCREEN_READY,    ///< Joysticks connected.
+    SCREEN_JOYSTICK, ///< Player count.
+    SCREEN_STARTING, ///< Game starting.
+    SCREEN_STOPPING, ///< Game stopping.
+    SCREEN_STOPPED,  ///< Game stopped.
+    SCREEN_PROGRESS  ///< Joystick bring-up progress, arg16: joystick.
+};
+
+/**
+ * @brief A trace record.
+ */
+struct TraceRecord
+{
+    uint32_t time;  ///< Value of micros() when the event was recorded.
+    uint8_t event;  ///< TraceEvent, 0 for a slot never written.
+    uint8_t arg8;   ///< First argument.
+    uint16_t arg16; ///< Second argument.
+};
+
+/** @brief Number of records kept, must be a power of two. */
+const uint16_t TRACE_SIZE = 256;
+
+/**
+ * @brief Records an event, from any task.
+ *
+ * @param event The TraceEvent.
+ * @param arg8 First argument.
+ * @param arg16 Second argument.
+ */
+void trace(uint8_t event, uint8_t arg8 = 0, uint16_t arg16 = 0);
+
+/**
+ * @brief Prints the records of the ring, oldest first, as hexadecimal lines.
+ */
+void printTrace();
+
+#endif // TRACE_H
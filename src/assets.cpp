@@ -0,0 +1,215 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Dabatnot, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file assets.cpp
+ * @brief Bitmaps of the firmware, packed in one aligned blob.
+ *
+ * Generated by tools/packAssets.py from assets/assets.txt and the PNG files of assets/, do not edit.
+ * Only the bitmaps referenced by the sources are kept. See assetStore.h for the format.
+ */
+
+#include "assets.h"
+
+// 2083 bytes: 59 tiles, then the bitmaps, packed from 3498 bytes. Unreferenced: player1_on, player2_on, player3_on, player4_on, player1_off, player2_off, player3_off, player4_off
+alignas(8) const uint8_t ASSET_BLOB[ASSET_BLOB_SIZE] PROGMEM = {
+	0xfc, 0x02, 0xf1, 0xf9, 0xfd, 0x7d, 0xbd, 0xdd, 0x5d, 0x1d, 0x3d, 0x7d, 0xfd, 0xfd, 0xfd, 0xfd,
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xf9, 0xf1, 0x02, 0xfc,
+	0xff, 0x00, 0xff, 0xff, 0xff, 0xfc, 0xf9, 0x00, 0xf0, 0x00, 0xf8, 0xfc, 0xff, 0xff, 0xf3, 0x61,
+	0x61, 0xf3, 0xff, 0xf3, 0x61, 0x61, 0xf3, 0xff, 0xf3, 0x61, 0x61, 0xf3, 0xff, 0xff, 0x00, 0xff,
+	0xff, 0x00, 0xff, 0xff, 0xfd, 0xf9, 0xf9, 0xf8, 0xfb, 0xf8, 0xf9, 0xf9, 0xfd, 0xff, 0xbc, 0x18,
+	0x18, 0xfc, 0xff, 0xfc, 0xf8, 0xf8, 0xfc, 0xff, 0xfc, 0xf8, 0xf8, 0xfc, 0xff, 0xff, 0x00, 0xff,
+	0x3f, 0x40, 0x8f, 0x9f, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xb0,
+	0xb0, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0x9f, 0x8f, 0x40, 0x3f,
+	0xfb, 0xf8, 0xf9, 0xf9, 0xfd, 0xff, 0xbc, 0xd8, 0xd8, 0x3c, 0xff, 0xfc, 0xf8, 0xf8, 0xfc, 0xff,
+	0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xb3, 0xb5, 0xb6, 0xb7, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf,
+	0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbb, 0xb7, 0xb6, 0xb9, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf,
+	0xfb, 0xf8, 0xf9, 0xf9, 0xfd, 0x7f, 0xbc, 0x18, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbc, 0xbd, 0xb0,
+	0xb0, 0xbd, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xfc, 0x02, 0xf1, 0x09, 0x05, 0x85, 0x45, 0x25,
+	0xa5, 0xe5, 0xc5, 0x85, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+	0x05, 0x05, 0x05, 0x05, 0x09, 0xf1, 0x02, 0xfc, 0xff, 0x00, 0xff, 0x00, 0x00, 0x03, 0x06, 0xff,
+	0x0f, 0xff, 0x07, 0x03, 0x00, 0x00, 0x0c, 0x9e, 0x9e, 0x0c, 0x00, 0x0c, 0x9e, 0x9e, 0x0c, 0x00,
+	0x0c, 0x9e, 0x9e, 0x0c, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0x02, 0x06, 0x06, 0x07,
+	0x04, 0x07, 0x06, 0x06, 0x02, 0x00, 0x43, 0xe7, 0xe7, 0x03, 0x00, 0x03, 0x07, 0x07, 0x03, 0x00,
+	0x03, 0x07, 0x07, 0x03, 0x00, 0xff, 0x00, 0xff, 0x3f, 0x40, 0x8f, 0x90, 0xa0, 0xa0, 0xa0, 0xa0,
+	0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xaf, 0xaf, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
+	0xa0, 0xa0, 0xa0, 0xa0, 0x90, 0x8f, 0x40, 0x3f, 0x04, 0x07, 0x06, 0x06, 0x02, 0x00, 0x43, 0x27,
+	0x27, 0xc3, 0x00, 0x03, 0x07, 0x07, 0x03, 0x00, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xac, 0xaa,
+	0xa9, 0xa8, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa4, 0xa8,
+	0xa9, 0xa6, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x04, 0x07, 0x06, 0x06, 0x02, 0x80, 0x43, 0xe7,
+	0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa3, 0xa2, 0xaf, 0xaf, 0xa2, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
+	0xfc, 0x02, 0xf1, 0x09, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x04,
+	0x04, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff,
+	0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x60, 0x20,
+	0x20, 0x60, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x7f, 0x80, 0xff, 0xff, 0x01, 0x00, 0xe0, 0xff,
+	0x7f, 0x00, 0xf0, 0xff, 0x7f, 0xc0, 0xff, 0x80, 0xff, 0xff, 0x03, 0xf8, 0xff, 0x3f, 0x30, 0x80,
+	0x03, 0xff, 0xff, 0x07, 0xfc, 0xff, 0x1f, 0x08, 0x00, 0x04, 0xfe, 0xff, 0x0f, 0xfe, 0x00, 0x00,
+	0x04, 0x00, 0x08, 0x00, 0xc0, 0x1f, 0x3e, 0x00, 0x00, 0x02, 0x00, 0x10, 0x00, 0x00, 0x1f, 0x1e,
+	0x00, 0x00, 0x02, 0x00, 0x10, 0x00, 0x00, 0x1e, 0x1f, 0x3c, 0x00, 0x01, 0x00, 0x20, 0x00, 0x03,
+	0x3e, 0x0f, 0x3c, 0x00, 0x01, 0x00, 0x20, 0x80, 0x07, 0x3c, 0x0f, 0x3c, 0x80, 0x00, 0x00, 0x20,
+	0x80, 0x07, 0x3c, 0x0f, 0x18, 0x80, 0x00, 0x00, 0x40, 0x20, 0x13, 0x3c, 0x8f, 0xc3, 0x81, 0x00,
+	0x00, 0x40, 0x70, 0x38, 0x3c, 0x8f, 0xe7, 0x81, 0x00, 0x00, 0x40, 0xf8, 0x7c, 0x3c, 0x8f, 0xc3,
+	0x81, 0x00, 0x00, 0x40, 0x70, 0x38, 0x3c, 0x0f, 0x18, 0x60, 0x80, 0x00, 0x00, 0x40, 0x20, 0x13,
+	0x3c, 0x0f, 0x3c, 0x80, 0x00, 0x00, 0x20, 0x80, 0x07, 0x3c, 0x0f, 0x3c, 0x00, 0x01, 0x00, 0x20,
+	0x80, 0x07, 0x3c, 0x1f, 0x3c, 0x00, 0x01, 0x00, 0x30, 0x00, 0x03, 0x3e, 0x1e, 0x00, 0x00, 0x02,
+	0x00, 0x10, 0x00, 0x00, 0x1e, 0x3e, 0x00, 0x00, 0x02, 0x00, 0x18, 0x00, 0x00, 0x1f, 0xfe, 0x00,
+	0x00, 0x04, 0x00, 0x08, 0x00, 0xc0, 0x1f, 0xfc, 0xff, 0x0f, 0x08, 0x00, 0x06, 0xfe, 0xff, 0x0f,
+	0xf8, 0xff, 0x1f, 0x70, 0x80, 0x03, 0xfe, 0xff, 0x07, 0xf0, 0xff, 0x3f, 0x80, 0x7f, 0x00, 0xff,
+	0xff, 0x03, 0x80, 0xff, 0xff, 0x00, 0x00, 0xc0, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03,
+	0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x00, 0x01, 0x02, 0x03,
+	0x04, 0x05, 0x06, 0x07, 0x08, 0x10, 0x11, 0x0b, 0x0c, 0x12, 0x13, 0x0f, 0x00, 0x01, 0x02, 0x03,
+	0x04, 0x05, 0x06, 0x07, 0x08, 0x10, 0x11, 0x0b, 0x0c, 0x14, 0x15, 0x0f, 0x00, 0x01, 0x02, 0x03,
+	0x04, 0x05, 0x06, 0x07, 0x08, 0x16, 0x0a, 0x0b, 0x0c, 0x17, 0x18, 0x0f, 0x19, 0x1a, 0x1b, 0x1c,
+	0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x19, 0x1a, 0x1b, 0x1c,
+	0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x29, 0x2a, 0x24, 0x25, 0x2b, 0x2c, 0x28, 0x19, 0x1a, 0x1b, 0x1c,
+	0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x29, 0x2a, 0x24, 0x25, 0x2d, 0x2e, 0x28, 0x19, 0x1a, 0x1b, 0x1c,
+	0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x2f, 0x23, 0x24, 0x25, 0x30, 0x31, 0x28, 0x32, 0x1b, 0x1b, 0x33,
+	0x34, 0x1b, 0x1b, 0x33, 0x34, 0x1b, 0x1b, 0x33, 0x34, 0x1b, 0x1b, 0x1c, 0x35, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x35, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x25, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x28, 0x32, 0x1b, 0x1b, 0x1b,
+	0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1c, 0x35, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x35, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x25, 0x38, 0x38, 0x39,
+	0x3a, 0x38, 0x38, 0x39, 0x3a, 0x38, 0x38, 0x39, 0x3a, 0x38, 0x38, 0x28, 0x4f, 0xfe, 0xf8, 0xc7,
+	0x0f, 0xff, 0xbc, 0xc7, 0x1f, 0x83, 0x09, 0x6c, 0x30, 0x81, 0xe5, 0x6c, 0x30, 0x39, 0x3b, 0x2f,
+	0x67, 0xe7, 0xe5, 0x2c, 0x67, 0xf9, 0x23, 0x2f, 0x67, 0xe4, 0xe5, 0x2c, 0x7f, 0x83, 0x23, 0x23,
+	0x67, 0x64, 0xe4, 0x6c, 0x70, 0x3f, 0x23, 0x23, 0x60, 0x64, 0xe4, 0xec, 0x67, 0x39, 0x23, 0x23,
+	0x67, 0x64, 0xe4, 0x2c, 0x67, 0x83, 0x23, 0x23, 0x67, 0x64, 0x0c, 0x6e, 0x70, 0xfe, 0xe3, 0xe3,
+	0x7f, 0x7c, 0xf8, 0xcf, 0x7f, 0xfc, 0xc0, 0xc3, 0x7b, 0x78, 0xf0, 0x87, 0x1f, 0x00, 0x00, 0x00,
+	0x1d, 0x80, 0x01, 0x40, 0x02, 0x40, 0x02, 0x20, 0x04, 0x3f, 0xfc, 0x01, 0x80, 0x42, 0x42, 0x44,
+	0x22, 0x48, 0x12, 0x08, 0x10, 0x04, 0x20, 0x84, 0x21, 0x62, 0x46, 0x12, 0x48, 0x0e, 0x70, 0x00,
+	0x07, 0x80, 0x01, 0xc0, 0x03, 0xc0, 0x03, 0xe0, 0x07, 0x82, 0xff, 0x11, 0xbe, 0x7d, 0xbc, 0x3d,
+	0xb8, 0x1d, 0xf8, 0x1f, 0xfc, 0x3f, 0xfc, 0x3f, 0x7e, 0x7e, 0x1e, 0x78, 0x0e, 0x70, 0x00, 0x00,
+	0x85, 0x00, 0x01, 0x30, 0x30, 0x8b, 0x00, 0x04, 0x48, 0x48, 0x00, 0x00, 0x3e, 0x87, 0x00, 0x05,
+	0xff, 0xcf, 0x4f, 0x00, 0x00, 0x41, 0x86, 0x00, 0x06, 0x80, 0x00, 0x48, 0xc8, 0x03, 0x80, 0x9c,
+	0x86, 0x00, 0x06, 0x40, 0x00, 0x48, 0x48, 0x04, 0x80, 0xa2, 0x86, 0x00, 0x06, 0x20, 0x00, 0x48,
+	0x48, 0x08, 0x80, 0xa2, 0x86, 0x00, 0x06, 0x20, 0x00, 0x48, 0x48, 0x08, 0x80, 0xa2, 0x81, 0x00,
+	0x81, 0xff, 0x08, 0x01, 0x00, 0x3e, 0x00, 0x48, 0x48, 0xf8, 0x80, 0xa2, 0x84, 0x00, 0x08, 0x02,
+	0xc0, 0x21, 0x00, 0x48, 0x48, 0x08, 0x87, 0xa2, 0x81, 0x00, 0x81, 0xff, 0x08, 0x04, 0x3c, 0x21,
+	0x00, 0x48, 0x48, 0x08, 0x79, 0xa2, 0x84, 0x00, 0x08, 0x09, 0x22, 0x21, 0x00, 0x48, 0x48, 0x08,
+	0x09, 0xa1, 0x84, 0x00, 0x09, 0x0a, 0x21, 0x21, 0x00, 0x48, 0x48, 0x08, 0x89, 0x20, 0x01, 0x83,
+	0x00, 0x0b, 0x8a, 0x3c, 0x21, 0x00, 0x48, 0x48, 0x08, 0x79, 0x40, 0xfe, 0xff, 0xff, 0x81, 0x00,
+	0x08, 0x8a, 0xc2, 0x21, 0x00, 0x48, 0x48, 0x08, 0x07, 0x80, 0x84, 0x00, 0x08, 0x8a, 0x02, 0x3e,
+	0x00, 0x48, 0x48, 0xf8, 0x00, 0x00, 0x81, 0xff, 0x81, 0x00, 0x06, 0x8a, 0x02, 0x20, 0x00, 0x48,
+	0x48, 0x08, 0x86, 0x00, 0x06, 0x8a, 0x02, 0x20, 0x00, 0x48, 0x48, 0x08, 0x86, 0x00, 0x06, 0x8a,
+	0x02, 0x40, 0x00, 0x48, 0x48, 0x04, 0x86, 0x00, 0x06, 0x72, 0x02, 0x80, 0x00, 0x48, 0xc8, 0x03,
+	0x86, 0x00, 0x05, 0x04, 0x01, 0x00, 0xff, 0xcf, 0x4f, 0x87, 0x00, 0x00, 0xf8, 0x81, 0x00, 0x01,
+	0x48, 0x48, 0x8b, 0x00, 0x01, 0x30, 0x30, 0x84, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x01, 0x80,
+	0x01, 0x81, 0x00, 0x00, 0x0c, 0x87, 0x00, 0x01, 0x40, 0x02, 0x81, 0x00, 0x03, 0x12, 0x00, 0x80,
+	0x0f, 0x83, 0x00, 0x09, 0xf8, 0x7f, 0x02, 0x00, 0x80, 0xff, 0x13, 0x00, 0x40, 0x10, 0x83, 0x00,
+	0x09, 0x04, 0x40, 0x02, 0x00, 0x80, 0x00, 0xf2, 0x00, 0x20, 0x27, 0x83, 0x00, 0x09, 0x02, 0x40,
+	0x02, 0x00, 0x80, 0x00, 0x12, 0x01, 0xa0, 0x28, 0x83, 0x00, 0x09, 0x01, 0x40, 0x02, 0x00, 0xff,
+	0x00, 0x12, 0x02, 0xa0, 0x28, 0x83, 0x00, 0x7f, 0x01, 0x40, 0x02, 0x80, 0xc0, 0x00, 0x12, 0x02,
+	0xa0, 0x28, 0x00, 0xff, 0x0f, 0x00, 0xf0, 0x01, 0x40, 0x02, 0x00, 0xff, 0x00, 0x12, 0x3e, 0xa0,
+	0x28, 0x00, 0x00, 0x10, 0x00, 0x0e, 0x01, 0x40, 0x02, 0x00, 0x80, 0x00, 0x12, 0xc2, 0xa1, 0x28,
+	0x00, 0xff, 0x27, 0xe0, 0x09, 0x01, 0x40, 0x02, 0x00, 0x80, 0x1f, 0x12, 0x42, 0x9e, 0x28, 0x00,
+	0x00, 0x48, 0x10, 0x09, 0x01, 0x40, 0x02, 0x00, 0x80, 0x10, 0x12, 0x42, 0x42, 0x28, 0x00, 0x00,
+	0x50, 0x08, 0x09, 0x01, 0x40, 0x02, 0x00, 0x80, 0x10, 0x12, 0x42, 0x22, 0x48, 0x00, 0x00, 0x50,
+	0xe4, 0x09, 0x01, 0x40, 0x02, 0x00, 0x80, 0x1f, 0x12, 0x42, 0x1e, 0x90, 0xff, 0x00, 0x50, 0x14,
+	0x0e, 0x01, 0x40, 0x02, 0x00, 0x80, 0x00, 0x12, 0xc2, 0x01, 0x20, 0x00, 0x00, 0x50, 0x14, 0xf0,
+	0x01, 0x40, 0x02, 0x00, 0xff, 0x00, 0x12, 0x3e, 0x0e, 0x00, 0xc0, 0xff, 0x00, 0x50, 0x14, 0x00,
+	0x01, 0x40, 0x02, 0x80, 0x80, 0x00, 0x12, 0x02, 0x82, 0x00, 0x0a, 0x50, 0x14, 0x00, 0x01, 0x40,
+	0x02, 0x00, 0xff, 0x00, 0x12, 0x02, 0x82, 0x00, 0x0a, 0x50, 0x14, 0x00, 0x02, 0x40, 0x02, 0x00,
+	0x80, 0x00, 0x12, 0x01, 0x82, 0x00, 0x09, 0x90, 0x13, 0x00, 0x04, 0x40, 0x02, 0x00, 0x80, 0x00,
+	0xf2, 0x83, 0x00, 0x09, 0x20, 0x08, 0x00, 0xf8, 0x7f, 0x02, 0x00, 0x80, 0xff, 0x13, 0x83, 0x00,
+	0x05, 0xc0, 0x07, 0x00, 0x00, 0x40, 0x02, 0x81, 0x00, 0x00, 0x12, 0x87, 0x00, 0x01, 0x80, 0x01,
+	0x81, 0x00, 0x00, 0x0c, 0x82, 0x00, 0x00, 0x00, 0x25, 0xc0, 0x00, 0x20, 0x01, 0x10, 0x02, 0x10,
+	0x02, 0xf0, 0x03, 0x10, 0x02, 0xd8, 0x06, 0xd4, 0x0a, 0xd2, 0x12, 0x11, 0x22, 0xfd, 0x2f, 0x13,
+	0x32, 0x11, 0x22, 0x01, 0x20, 0xe0, 0x01, 0x10, 0x02, 0x10, 0x02, 0x20, 0x01, 0xc0, 0x00, 0x00,
+	0x63, 0xfe, 0xf8, 0xc7, 0x0f, 0x7f, 0xf8, 0xe7, 0x79, 0x8f, 0x1f, 0x83, 0x09, 0x6c, 0x30, 0x81,
+	0x08, 0x2c, 0xcb, 0xd9, 0x20, 0x39, 0x3b, 0x2f, 0x67, 0x39, 0x3b, 0x2f, 0x8b, 0x59, 0xce, 0xf9,
+	0x23, 0x2f, 0x67, 0x39, 0x23, 0x2f, 0x0b, 0x59, 0xfe, 0x83, 0x23, 0x23, 0x67, 0x81, 0x23, 0x23,
+	0x4b, 0x58, 0xc6, 0x3f, 0x23, 0x23, 0x60, 0x39, 0x23, 0x23, 0xcb, 0x58, 0xce, 0x39, 0x23, 0x23,
+	0x67, 0x39, 0x23, 0x23, 0xcb, 0x59, 0xce, 0x83, 0x23, 0x23, 0x67, 0x39, 0x23, 0x23, 0xcb, 0xd9,
+	0xd0, 0xfe, 0xe3, 0xe3, 0x7f, 0xff, 0xe3, 0xe3, 0xfb, 0x9f, 0xff, 0xfc, 0xc0, 0xc3, 0x7b, 0xde,
+	0xc3, 0xc3, 0xf3, 0x1e, 0xff, 0x00, 0x00, 0x00, 0x2c, 0xe0, 0x1f, 0x00, 0x18, 0x60, 0x00, 0x04,
+	0x80, 0x00, 0x02, 0x38, 0x01, 0x82, 0x23, 0x01, 0x39, 0x12, 0x01, 0x21, 0x09, 0x01, 0x91, 0x38,
+	0x01, 0x89, 0x03, 0x01, 0x39, 0x00, 0x01, 0x01, 0x80, 0x00, 0x02, 0x60, 0x00, 0xf2, 0x1f, 0x00,
+	0x0a, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x63, 0xfe, 0xf8, 0xc7, 0x8f, 0x7f, 0xfc, 0xe3,
+	0x79, 0x8f, 0x1f, 0x83, 0x09, 0x6c, 0x98, 0xc0, 0x04, 0x26, 0xcb, 0xd9, 0x20, 0x39, 0x3b, 0x2f,
+	0xb3, 0x9c, 0xe5, 0x2c, 0x8b, 0x59, 0xce, 0xf9, 0x23, 0x2f, 0xb3, 0x9c, 0xe5, 0x2c, 0x0b, 0x59,
+	0xfe, 0x83, 0x23, 0x23, 0xb3, 0x9c, 0xe5, 0x2c, 0x4b, 0x58, 0xc6, 0x3f, 0x23, 0x23, 0xb3, 0xc0,
+	0x05, 0x2e, 0xcb, 0x58, 0xce, 0x39, 0x23, 0x23, 0xb3, 0xfc, 0xe5, 0x2f, 0xcb, 0x59, 0xce, 0x83,
+	0x23, 0x63, 0xb8, 0xfc, 0xe4, 0x27, 0xcb, 0xd9, 0xd0, 0xfe, 0xe3, 0xe3, 0xbf, 0x0f, 0x7c, 0xe0,
+	0xfb, 0x9f, 0xff, 0xfc, 0xc0, 0xc3, 0x3f, 0x0f, 0x78, 0xc0, 0xf3, 0x1e, 0xff, 0x00, 0x00, 0x00,
+	0x63, 0xfe, 0xf8, 0xc7, 0x8f, 0x7f, 0xfc, 0xe3, 0x3f, 0x7f, 0x00, 0x83, 0x09, 0x6c, 0x98, 0xc0,
+	0x04, 0x26, 0x60, 0xc1, 0x00, 0x39, 0x3b, 0x2f, 0xb3, 0x9c, 0xe5, 0x2c, 0x7f, 0x99, 0x01, 0xf9,
+	0x23, 0x2f, 0xb3, 0x9c, 0xe5, 0x2c, 0x7f, 0x39, 0x03, 0x83, 0x23, 0x23, 0xb3, 0x9c, 0xe5, 0x2c,
+	0x30, 0x39, 0x03, 0x3f, 0x23, 0x23, 0xb3, 0xc0, 0x05, 0x2e, 0x3f, 0x39, 0x03, 0x39, 0x23, 0x23,
+	0xb3, 0xfc, 0xe5, 0x2f, 0x3f, 0x99, 0x03, 0x83, 0x23, 0x63, 0xb8, 0xfc, 0xe4, 0x27, 0x60, 0xc1,
+	0x03, 0xfe, 0xe3, 0xe3, 0xbf, 0x0f, 0x7c, 0xe0, 0x7f, 0xff, 0x01, 0xfc, 0xc0, 0xc3, 0x3f, 0x0f,
+	0x78, 0xc0, 0x7f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x29, 0xfc, 0xff, 0x03, 0x02, 0x00, 0x04, 0x01,
+	0x00, 0x08, 0x39, 0xe9, 0x09, 0x49, 0x29, 0x08, 0x39, 0xee, 0x08, 0x49, 0x28, 0x08, 0x79, 0xe6,
+	0x09, 0x01, 0x00, 0x08, 0x02, 0x00, 0x04, 0xfc, 0x9f, 0x03, 0x00, 0x50, 0x00, 0x00, 0x30, 0x00,
+	0x00, 0x10, 0x00};
+
+const PackedAsset *const ALL_ASSETS[ASSET_COUNT] = {
+	&Azway_Logo,
+	&JoyONJ1On,
+	&JoyONJ2On,
+	&JoyONJ3On,
+	&JoyONJ4On,
+	&JoyOFFJ1Off,
+	&JoyOFFJ2Off,
+	&JoyOFFJ3Off,
+	&JoyOFFJ4Off,
+	&FrameTopFrame,
+	&FrameBottomFrame,
+	&bmpStatus,
+	&FrameStarBlack,
+	&FrameStarWhite,
+	&ConnectionStateConnected,
+	&ConnectionStateConnecting,
+	&bmpRocket,
+	&bmpStarting,
+	&bmpZZZ,
+	&bmpStopping,
+	&bmpStopped,
+	&bmpBye};
+
+const char *const ASSET_NAMES[ASSET_COUNT] = {
+	"Azway_Logo",
+	"JoyONJ1On",
+	"JoyONJ2On",
+	"JoyONJ3On",
+	"JoyONJ4On",
+	"JoyOFFJ1Off",
+	"JoyOFFJ2Off",
+	"JoyOFFJ3Off",
+	"JoyOFFJ4Off",
+	"FrameTopFrame",
+	"FrameBottomFrame",
+	"bmpStatus",
+	"FrameStarBlack",
+	"FrameStarWhite",
+	"ConnectionStateConnected",
+	"ConnectionStateConnecting",
+	"bmpRocket",
+	"bmpStarting",
+	"bmpZZZ",
+	"bmpStopping",
+	"bmpStopped",
+	"bmpBye"};
@@ -0,0 +1,252 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file binaryProtocol.cpp
+ * @brief Source file for the binary framed serial protocol.
+ *
+ * This file contains the CRC and COBS codecs, the packet decoder and the console output.
+ */
+
+#include "binaryProtocol.h"
+
+/**
+ * @brief Computes the CRC-16/CCITT-FALSE of a buffer, bit by bit to keep the flash footprint small.
+ *
+ * @param data The bytes to check.
+ * @param length Number of bytes.
+ * @param crc Initial value, the CRC of the previous bytes to chain calls.
+ */
+uint16_t crc16(const uint8_t *data, size_t length, uint16_t crc)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        crc ^= (uint16_t)data[i] << 8;
+        for (uint8_t bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+/**
+ * @brief COBS encodes a buffer of up to 254 bytes, without the delimiter.
+ *
+ * Every zero is replaced by the distance to the next zero, the first byte giving the distance to
+ * the first one.
+ *
+ * @param in The bytes to encode.
+ * @param length Number of bytes.
+ * @param out Encoded bytes, length + 1 bytes.
+ * @return Number of encoded bytes.
+ */
+size_t cobsEncode(const uint8_t *in, size_t length, uint8_t *out)
+{
+    size_t code = 0;
+    size_t o = 1;
+    for (size_t i = 0; i < length; i++)
+    {
+        if (in[i] == 0)
+        {
+            out[code] = (uint8_t)(o - code);
+            code = o++;
+        }
+        else
+        {
+            out[o++] = in[i];
+        }
+    }
+    out[code] = (uint8_t)(o - code);
+    return o;
+}
+
+/**
+ * @brief Decodes a COBS frame received without its delimiter.
+ *
+ * @param in The encoded bytes, which may be the same buffer as out.
+ * @param length Number of encoded bytes.
+ * @param out Decoded bytes.
+ * @return Number of decoded bytes, 0 if the frame is malformed.
+ */
+size_t cobsDecode(const uint8_t *in, size_t length, uint8_t *out)
+{
+    size_t i = 0;
+    size_t o = 0;
+    while (i < length)
+    {
+        uint8_t code = in[i];
+        if (code == 0 || i + code > length)
+        {
+            return 0;
+        }
+        i++;
+        for (uint8_t k = 1; k < code; k++)
+        {
+            out[o++] = in[i++];
+        }
+        if (code < 0xFF && i < length)
+        {
+            out[o++] = 0;
+        }
+    }
+    return o;
+}
+
+/**
+ * @brief Appends a received byte to the current frame.
+ *
+ * The frame is decoded in place once its delimiter is received, then the CRC is checked.
+ *
+ * @param c The received byte.
+ * @param packet Filled when the byte completes a valid packet.
+ * @return true if a packet was completed.
+ */
+bool PacketDecoder::push(uint8_t c, Packet &packet)
+{
+    if (c != 0)
+    {
+        if (length == PACKET_MAX_FRAME)
+        {
+            overflow = true;
+        }
+        else
+        {
+            frame[length++] = c;
+        }
+        return false;
+    }
+
+    // Delimiter: decode the frame received so far
+    uint8_t encoded = length;
+    bool dropped = overflow;
+    length = 0;
+    overflow = false;
+    if (encoded == 0)
+    {
+        return false; // Empty frame, used by the host to resynchronize
+    }
+
+    size_t size = dropped ? 0 : cobsDecode(frame, encoded, frame);
+    if (size < 4 || crc16(frame, size - 2) != (uint16_t)((frame[size - 2] << 8) | frame[size - 1]))
+    {
+        errors++;
+        return false;
+    }
+
+    packet.seq = frame[0];
+    packet.opcode = frame[1];
+    packet.payload = &frame[2];
+    packet.length = (uint8_t)(size - 4);
+    return true;
+}
+
+/**
+ * @brief Encodes and sends a packet, in a single write.
+ *
+ * @param out Where to write the frame.
+ * @param seq Sequence number.
+ * @param opcode Opcode.
+ * @param payload Payload bytes.
+ * @param length Number of payload bytes, at most PACKET_MAX_PAYLOAD.
+ */
+void sendPacket(Print &out, uint8_t seq, uint8_t opcode, const uint8_t *payload, uint8_t length)
+{
+    if (length > PACKET_MAX_PAYLOAD)
+    {
+        length = PACKET_MAX_PAYLOAD;
+    }
+
+    uint8_t raw[PACKET_MAX_RAW];
+    raw[0] = seq;
+    raw[1] = opcode;
+    memcpy(&raw[2], payload, length);
+    uint16_t crc = crc16(raw, length + 2);
+    raw[length + 2] = crc >> 8;
+    raw[length + 3] = crc & 0xFF;
+
+    uint8_t frame[PACKET_MAX_FRAME];
+    size_t size = cobsEncode(raw, length + 4, frame);
+    frame[size++] = 0;
+    out.write(frame, size);
+}
+
+/**
+ * @brief Selects the protocol, a line being collected is dropped.
+ * @param enabled Whether the binary protocol is used.
+ */
+void ConsolePrint::setBinary(bool enabled)
+{
+    binaryMode = enabled;
+    lineLength = 0;
+}
+
+/**
+ * @brief Writes a byte to Serial, or to the line being collected in binary mode.
+ *
+ * Carriage returns are dropped in binary mode, a line longer than a payload is split.
+ *
+ * @param c The byte.
+ */
+size_t ConsolePrint::write(uint8_t c)
+{
+    if (!binaryMode)
+    {
+        return Serial.write(c);
+    }
+
+    if (c == '\n' || lineLength == PACKET_MAX_PAYLOAD)
+    {
+        sendPacket(Serial, 0, OP_TEXT, line, lineLength);
+        lineLength = 0;
+    }
+    if (c != '\n' && c != '\r')
+    {
+        line[lineLength++] = c;
+    }
+    return 1;
+}
+
+/**
+ * @brief Writes a buffer, in one Serial write in text mode.
+ *
+ * @param buffer The bytes.
+ * @param size Number of bytes.
+ */
+size_t ConsolePrint::write(const uint8_t *buffer, size_t size)
+{
+    if (!binaryMode)
+    {
+        return Serial.write(buffer, size);
+    }
+
+    for (size_t i = 0; i < size; i++)
+    {
+        write(buffer[i]);
+    }
+    return size;
+}
+
+/// Global output of the firmware messages
+ConsolePrint console;
@@ -21,7 +21,6 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  ****************************************************************************************/
-
 /**
  * @file bitmapManager.cpp
  * @brief Source file to manage bitmap creation and display on the OLED screen.
@@ -29,10 +28,428 @@
  * This file contains the function implementations to draw various bitmaps and screens on an OLED display
  * using the HT_SSD1306Wire library. The functions include drawing logos, loading screens,
  * and different status screens.
+ *
+ * The status screens are scenes: lists of layers taken from the LAYERS table, each layer being an
+ * asset at a fixed position, drawn when its condition holds. Adding a screen is adding a scene.
+ * In full buffer mode the compositor keeps the last composed scene in the frame buffer and only
+ * redraws the layers that differ, plus the ones they overlap. In page mode the buffer holds one
+ * page, so every layer of the scene is drawn for each page.
  */
 
 #include "bitmapManager.h"
+#include "assets.h"
 #include "display.h"
+#include "trace.h"
+
+/**
+ * @brief How a layer is drawn.
+ */
+enum LayerKind : uint8_t
+{
+    LAYER_ASSET,   ///< Packed bitmap drawn with drawAsset(), opaque.
+    LAYER_PROGRESS ///< Progress bar showing shownProgress, drawn over the layers below.
+};
+
+/**
+ * @brief Condition for a layer to be drawn.
+ */
+enum LayerCondition : uint8_t
+{
+    COND_ALWAYS,     ///< Always drawn.
+    COND_READY,      ///< Drawn when the status is READY.
+    COND_NOT_READY,  ///< Drawn when the status is not READY.
+    COND_PLAYER_ON,  ///< Drawn when joystick arg is connected.
+    COND_PLAYER_OFF  ///< Drawn when joystick arg is not connected.
+};
+
+/**
+ * @brief Layer of a scene: an asset at a fixed position.
+ */
+struct SceneLayer
+{
+    LayerKind kind;           ///< How the layer is drawn.
+    LayerCondition condition; ///< When the layer is drawn.
+    uint8_t arg;              ///< Argument of the condition.
+    uint8_t x;                ///< Left of the layer.
+    uint8_t y;                ///< Top of the layer.
+    uint8_t width;            ///< Width of the layer, of the bitmap for an asset.
+    uint8_t height;           ///< Height of the layer, of the bitmap for an asset.
+    const PackedAsset *asset; ///< Bitmap, NULL for a progress bar.
+};
+
+/**
+ * @brief Layer drawing an asset, sized after it.
+ */
+static constexpr SceneLayer assetLayer(LayerCondition condition, uint8_t arg, uint8_t x, uint8_t y,
+                                       const PackedAsset &asset)
+{
+    return SceneLayer{LAYER_ASSET, condition, arg, x, y, asset.width, asset.height, &asset};
+}
+
+/**
+ * @brief Identifiers of the layers, in drawing order.
+ */
+enum LayerId : uint8_t
+{
+    L_TOP_FRAME,
+    L_STATUS,
+    L_STAR_LEFT_OFF,
+    L_STAR_LEFT_ON,
+    L_STAR_RIGHT_OFF,
+    L_STAR_RIGHT_ON,
+    L_BOTTOM_FRAME,
+    L_JOY1_ON,
+    L_JOY1_OFF,
+    L_JOY2_ON,
+    L_JOY2_OFF,
+    L_JOY3_ON,
+    L_JOY3_OFF,
+    L_JOY4_ON,
+    L_JOY4_OFF,
+    L_CONNECTED,
+    L_CONNECTING,
+    L_PROGRESS,
+    L_ROCKET_LEFT,
+    L_ROCKET_RIGHT,
+    L_STARTING,
+    L_ZZZ_LEFT,
+    L_ZZZ_RIGHT,
+    L_STOPPING,
+    L_BYE_LEFT,
+    L_BYE_RIGHT,
+    L_STOPPED,
+    LAYER_COUNT
+};
+
+/// All layers, indexed by LayerId. FrameBottomFrame is the frame of the top half, the naming of the art is swapped.
+static constexpr SceneLayer LAYERS[LAYER_COUNT] = {
+    assetLayer(COND_ALWAYS, 0, 0, 0, FrameBottomFrame),
+    assetLayer(COND_ALWAYS, 0, 32, 11, bmpStatus),
+    assetLayer(COND_NOT_READY, 0, 6, 8, FrameStarBlack),
+    assetLayer(COND_READY, 0, 6, 8, FrameStarWhite),
+    assetLayer(COND_NOT_READY, 0, 106, 8, FrameStarBlack),
+    assetLayer(COND_READY, 0, 106, 8, FrameStarWhite),
+    assetLayer(COND_ALWAYS, 0, 0, 32, FrameTopFrame),
+    assetLayer(COND_PLAYER_ON, 0, 0, 32, JoyONJ1On),
+    assetLayer(COND_PLAYER_OFF, 0, 0, 32, JoyOFFJ1Off),
+    assetLayer(COND_PLAYER_ON, 1, 32, 32, JoyONJ2On),
+    assetLayer(COND_PLAYER_OFF, 1, 32, 32, JoyOFFJ2Off),
+    assetLayer(COND_PLAYER_ON, 2, 64, 32, JoyONJ3On),
+    assetLayer(COND_PLAYER_OFF, 2, 64, 32, JoyOFFJ3Off),
+    assetLayer(COND_PLAYER_ON, 3, 96, 32, JoyONJ4On),
+    assetLayer(COND_PLAYER_OFF, 3, 96, 32, JoyOFFJ4Off),
+    assetLayer(COND_ALWAYS, 0, 4, 38, ConnectionStateConnected),
+    assetLayer(COND_ALWAYS, 0, 4, 38, ConnectionStateConnecting),
+    {LAYER_PROGRESS, COND_ALWAYS, 0, 5, 42, 117, 11, NULL},
+    assetLayer(COND_ALWAYS, 0, 6, 39, bmpRocket),
+    assetLayer(COND_ALWAYS, 0, 109, 39, bmpRocket),
+    assetLayer(COND_ALWAYS, 0, 25, 43, bmpStarting),
+    assetLayer(COND_ALWAYS, 0, 4, 41, bmpZZZ),
+    assetLayer(COND_ALWAYS, 0, 107, 41, bmpZZZ),
+    assetLayer(COND_ALWAYS, 0, 24, 43, bmpStopping),
+    assetLayer(COND_ALWAYS, 0, 4, 42, bmpBye),
+    assetLayer(COND_ALWAYS, 0, 104, 42, bmpBye),
+    assetLayer(COND_ALWAYS, 0, 27, 43, bmpStopped),
+};
+
+/**
+ * @brief Checks that the ASSET_TILES layers sit on a page boundary, drawAsset() copies their tiles as is.
+ *
+ * Recursive so that it stays a C++11 constant expression.
+ */
+static constexpr bool tilesPageAligned(size_t index = 0)
+{
+    return index >= LAYER_COUNT ||
+           ((LAYERS[index].kind != LAYER_ASSET || LAYERS[index].asset->format != ASSET_TILES ||
+             LAYERS[index].y % 8 == 0) &&
+            tilesPageAligned(index + 1));
+}
+
+static_assert(tilesPageAligned(), "ASSET_TILES layers must be drawn at a y multiple of 8");
+
+/// Layers shared by the screens: frame, title and stars of the top half
+#define MAIN_LAYERS L_TOP_FRAME, L_STATUS, L_STAR_LEFT_OFF, L_STAR_LEFT_ON, L_STAR_RIGHT_OFF, L_STAR_RIGHT_ON
+
+/// Scenes, layer lists in drawing order
+static constexpr uint8_t WAITING_SCENE[] = {MAIN_LAYERS, L_BOTTOM_FRAME, L_CONNECTING};
+static constexpr uint8_t READY_SCENE[] = {MAIN_LAYERS, L_BOTTOM_FRAME, L_CONNECTED};
+static constexpr uint8_t PROGRESS_SCENE[] = {MAIN_LAYERS, L_BOTTOM_FRAME, L_PROGRESS};
+static constexpr uint8_t JOYSTICK_SCENE[] = {MAIN_LAYERS, L_JOY1_ON, L_JOY1_OFF, L_JOY2_ON, L_JOY2_OFF,
+                                             L_JOY3_ON, L_JOY3_OFF, L_JOY4_ON, L_JOY4_OFF};
+static constexpr uint8_t STARTING_SCENE[] = {MAIN_LAYERS, L_BOTTOM_FRAME, L_ROCKET_LEFT, L_ROCKET_RIGHT, L_STARTING};
+static constexpr uint8_t STOPPING_SCENE[] = {MAIN_LAYERS, L_BOTTOM_FRAME, L_ZZZ_LEFT, L_ZZZ_RIGHT, L_STOPPING};
+static constexpr uint8_t STOPPED_SCENE[] = {MAIN_LAYERS, L_BOTTOM_FRAME, L_BYE_LEFT, L_BYE_RIGHT, L_STOPPED};
+
+/**
+ * @brief Checks that a scene lists its layers in drawing order, which the compositor relies on.
+ *
+ * Recursive so that it stays a C++11 constant expression.
+ */
+template <size_t N>
+static constexpr bool inDrawingOrder(const uint8_t (&scene)[N], size_t index = 1)
+{
+    return index >= N || (scene[index] > scene[index - 1] && inDrawingOrder(scene, index + 1));
+}
+
+static_assert(inDrawingOrder(WAITING_SCENE) && inDrawingOrder(READY_SCENE) && inDrawingOrder(PROGRESS_SCENE) &&
+                  inDrawingOrder(JOYSTICK_SCENE) && inDrawingOrder(STARTING_SCENE) &&
+                  inDrawingOrder(STOPPING_SCENE) && inDrawingOrder(STOPPED_SCENE),
+              "scene layers must be listed in LayerId order");
+
+/** @brief Maximum number of visible layers in a scene. */
+static const uint8_t MAX_VISIBLE_LAYERS = 16;
+
+/// Number of connected joysticks drawn by the joystick screen
+static int shownPlayers = 0;
+
+/// Progress drawn by the progress screen, in percent
+static uint8_t shownProgress = 0;
+
+/// Visible layers of the scene being drawn
+static uint8_t visibleLayers[MAX_VISIBLE_LAYERS];
+
+/// Number of visible layers of the scene being drawn
+static uint8_t visibleCount = 0;
+
+#ifndef DISPLAY_PAGE_MODE
+/// Visible layers of the scene held by the frame buffer
+static uint8_t composedLayers[MAX_VISIBLE_LAYERS];
+
+/// Number of visible layers of the scene held by the frame buffer
+static uint8_t composedCount = 0;
+
+/// Progress drawn in the frame buffer
+static uint8_t composedProgress = 0;
+
+/// Whether the frame buffer holds composedLayers
+static bool composedValid = false;
+#endif
+
+/**
+ * @brief Checks whether the condition of a layer holds.
+ */
+static bool layerVisible(const SceneLayer &layer)
+{
+    switch (layer.condition)
+    {
+    case COND_READY:
+        return currentStatus == READY;
+    case COND_NOT_READY:
+        return currentStatus != READY;
+    case COND_PLAYER_ON:
+        return layer.arg < shownPlayers;
+    case COND_PLAYER_OFF:
+        return layer.arg >= shownPlayers;
+    default:
+        return true;
+    }
+}
+
+/**
+ * @brief Draws a layer into the frame buffer.
+ */
+static void drawLayer(const SceneLayer &layer)
+{
+    switch (layer.kind)
+    {
+    case LAYER_ASSET:
+        display.drawAsset(layer.x, layer.y, *layer.asset);
+        break;
+    case LAYER_PROGRESS:
+        // The bar covers one pixel more than its size in each direction
+        display.drawProgressBar(layer.x, layer.y, layer.width - 1, layer.height - 1, shownProgress);
+        break;
+    }
+}
+
+/**
+ * @brief Draws every visible layer, draw list of the scene being shown.
+ */
+static void drawScene()
+{
+    for (uint8_t i = 0; i < visibleCount; i++)
+    {
+        drawLayer(LAYERS[visibleLayers[i]]);
+    }
+}
+
+#ifndef DISPLAY_PAGE_MODE
+
+/**
+ * @brief Axis aligned rectangle of the frame.
+ */
+struct Rect
+{
+    uint8_t x;      ///< Left.
+    uint8_t y;      ///< Top.
+    uint8_t width;  ///< Width.
+    uint8_t height; ///< Height.
+};
+
+/**
+ * @brief Returns the area covered by a layer.
+ */
+static Rect layerRect(const SceneLayer &layer)
+{
+    return Rect{layer.x, layer.y, layer.width, layer.height};
+}
+
+/**
+ * @brief Checks whether two rectangles overlap.
+ */
+static bool overlaps(const Rect &a, const Rect &b)
+{
+    return a.x < b.x + b.width && b.x < a.x + a.width && a.y < b.y + b.height && b.y < a.y + a.height;
+}
+
+/**
+ * @brief Checks whether a rectangle lies inside another one.
+ */
+static bool contains(const Rect &outer, const Rect &inner)
+{
+    return inner.x >= outer.x && inner.y >= outer.y && inner.x + inner.width <= outer.x + outer.width &&
+           inner.y + inner.height <= outer.y + outer.height;
+}
+
+/**
+ * @brief Checks whether a layer is in a list of layers.
+ */
+static bool listed(const uint8_t *layers, uint8_t count, uint8_t id)
+{
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (layers[i] == id)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Checks whether a layer of the new scene was not drawn, or drawn differently, in the frame buffer.
+ */
+static bool layerChanged(uint8_t id)
+{
+    return !listed(composedLayers, composedCount, id) ||
+           (LAYERS[id].kind == LAYER_PROGRESS && composedProgress != shownProgress);
+}
+
+/**
+ * @brief Turns the frame buffer from the composed scene into the visible layers, redrawing only what differs.
+ *
+ * An opaque layer overwrites its whole area, so a new opaque layer is simply drawn. The area of a
+ * removed layer is cleared, unless a new opaque layer covers it, and so is the area of a changed
+ * progress bar, which only sets pixels. Walking the layers in drawing order, a layer is then drawn
+ * if it is new or overlaps an area cleared or drawn before, so the layers above are kept on top.
+ */
+static void composeChanges()
+{
+    Rect dirty[2 * MAX_VISIBLE_LAYERS];
+    uint8_t dirtyCount = 0;
+
+    // Areas to rebuild from the layers below
+    for (uint8_t i = 0; i < composedCount; i++)
+    {
+        uint8_t id = composedLayers[i];
+        if (listed(visibleLayers, visibleCount, id) && !layerChanged(id))
+        {
+            continue;
+        }
+        Rect area = layerRect(LAYERS[id]);
+        bool covered = false;
+        for (uint8_t j = 0; j < visibleCount && !covered; j++)
+        {
+            const SceneLayer &layer = LAYERS[visibleLayers[j]];
+            covered = layer.kind != LAYER_PROGRESS && layerChanged(visibleLayers[j]) && contains(layerRect(layer), area);
+        }
+        if (!covered)
+        {
+            dirty[dirtyCount++] = area;
+        }
+    }
+    display.setDrawColor(0);
+    for (uint8_t i = 0; i < dirtyCount; i++)
+    {
+        display.drawBox(dirty[i].x, dirty[i].y, dirty[i].width, dirty[i].height);
+    }
+    display.setDrawColor(1);
+
+    // Draw the new layers and every layer over a redrawn area
+    for (uint8_t i = 0; i < visibleCount; i++)
+    {
+        const SceneLayer &layer = LAYERS[visibleLayers[i]];
+        Rect area = layerRect(layer);
+        bool redraw = layerChanged(visibleLayers[i]);
+        for (uint8_t j = 0; j < dirtyCount && !redraw; j++)
+        {
+            redraw = overlaps(dirty[j], area);
+        }
+        if (redraw)
+        {
+            drawLayer(layer);
+            dirty[dirtyCount++] = area;
+        }
+    }
+}
+
+#endif // DISPLAY_PAGE_MODE
+
+/**
+ * @brief Shows a scene: selects its visible layers, composes them and sends the frame.
+ *
+ * @param layers The layers of the scene, in drawing order.
+ * @param count Number of layers.
+ */
+static void showScene(const uint8_t *layers, uint8_t count)
+{
+    visibleCount = 0;
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (layerVisible(LAYERS[layers[i]]))
+        {
+            visibleLayers[visibleCount++] = layers[i];
+        }
+    }
+
+#ifdef DISPLAY_PAGE_MODE
+    display.render(drawScene);
+#else
+    if (!composedValid)
+    {
+        display.render(drawScene);
+    }
+    else
+    {
+        composeChanges();
+        display.sendBuffer();
+    }
+    memcpy(composedLayers, visibleLayers, visibleCount);
+    composedCount = visibleCount;
+    composedProgress = shownProgress;
+    composedValid = true;
+#endif
+}
+
+/**
+ * @brief Shows one of the scene tables.
+ */
+template <size_t N>
+static void showScene(const uint8_t (&scene)[N])
+{
+    static_assert(N <= MAX_VISIBLE_LAYERS, "too many layers in a scene");
+    showScene(scene, N);
+}
+
+/**
+ * @brief Forgets the scene held by the frame buffer, the next screen is drawn in full.
+ */
+void invalidateScreen()
+{
+#ifndef DISPLAY_PAGE_MODE
+    composedValid = false;
+#endif
+}
 
 /**
  * @brief Draws the logo on the OLED display.
@@ -42,7 +459,7 @@ void drawLogo()
     display.setFont(u8g2_font_helvR10_tf); // Remplacez par la police adéquate
 
     // Affiche le logo à une position fixe
-    display.drawXBMP(29, 10, Azway_Logo_width, Azway_Logo_height, Azway_Logo);
+    display.drawAsset(29, 10, Azway_Logo);
 
     // Chaîne de texte à afficher
     const char *text = "AZWAY RETRO";
@@ -55,16 +472,10 @@ void drawLogo()
 }
 
 /**
- * @brief Displays a loading screen with progress bars for joystick initialization.
- *
- * This function sets the LED status to CONFIG and iterates through the joysticks,
- * displaying a progress bar for each one. Once done, it sets the display to a "Ready" state.
+ * @brief Draws the logo and the controller version.
  */
-void loadingScreen()
+static void drawLoading()
 {
-    // Clear the display buffer
-    display.clearBuffer();
-
     // Draw the logo
     drawLogo();
 
@@ -79,16 +490,34 @@ void loadingScreen()
 
     // Set the font and draw the version text
     display.drawStr(x, y, versionText);
+}
 
-    // Send the buffer content to the display
-    display.sendBuffer();
+/**
+ * @brief Draws the logo and the controller version and sends them to the display, without waiting.
+ */
+void drawLoadingScreen()
+{
+    trace(TRACE_SCREEN, SCREEN_LOADING);
+    invalidateScreen();
+    display.render(drawLoading);
+}
+
+/**
+ * @brief Displays a loading screen with progress bars for joystick initialization.
+ *
+ * This function sets the LED status to CONFIG and iterates through the joysticks,
+ * displaying a progress bar for each one. Once done, it sets the display to a "Ready" state.
+ */
+void loadingScreen()
+{
+    // Draw the logo and the version
+    drawLoadingScreen();
 
     // Wait for 10 seconds
     delay(10000);
 
     // Clear the display
-    display.clearBuffer();
-    display.sendBuffer();
+    display.render(NULL);
 
     // Update the current status
     // currentStatus = WAITING;
@@ -97,56 +526,25 @@ void loadingScreen()
     disconnectAllRelays();
 }
 
-/**
- * @brief Draws the top frame on the OLED display.
- */
-void topFrame()
-{
-    display.drawXBMP(0, 0, Frame_width, Frame_height, BmpFrame[0]);
-}
-
-/**
- * @brief Draws the bottom frame on the OLED display.
- */
-void bottomFrame()
-{
-    display.drawXBMP(0, 32, Frame_width, Frame_height, BmpFrame[1]);
-}
-
-/**
- * @brief Displays the main screen on the OLED display.
- */
-void mainScreen()
-{
-    topFrame();
-    display.drawXBMP(32, 11, bmpStatus_width, bmpStatus_height, bmpStatus);
-    if (currentStatus == READY)
-    {
-        display.drawXBMP(6, 8, bmpStar_width, bmpStar_height, bmpStar[1]);
-        display.drawXBMP(106, 8, bmpStar_width, bmpStar_height, bmpStar[1]);
-    }
-    else
-    {
-        display.drawXBMP(6, 8, bmpStar_width, bmpStar_height, bmpStar[0]);
-        display.drawXBMP(106, 8, bmpStar_width, bmpStar_height, bmpStar[0]);
-    }
-}
-
 /**
  * @brief Displays the joystick screen on the OLED display.
+ * @param nbPlayers Number of connected joysticks, clamped to 0-4.
  */
-void joystickScreen()
+void joystickScreen(int nbPlayers)
 {
-    mainScreen();
+    trace(TRACE_SCREEN, SCREEN_JOYSTICK);
+    shownPlayers = max(0, min(nbPlayers, 4));
+    showScene(JOYSTICK_SCENE);
 }
 
 /**
- * @brief Displays the status screen on the OLED display.
+ * @brief Displays the status screen with a progress bar.
+ * @param progress The progress in percent.
  */
-void statusScreen()
+void progressScreen(uint8_t progress)
 {
-    mainScreen();
-    bottomFrame();
+    shownProgress = progress;
+    showScene(PROGRESS_SCENE);
 }
 
 /**
@@ -154,17 +552,8 @@ void statusScreen()
  */
 void waitingScreen()
 {
-    // Clear the display buffer
-    display.clearBuffer();
-
-    // Draw the status screen
-    statusScreen();
-
-    // Draw the bitmap at the specified position
-    display.drawXBMP(4, 38, bmpConnection_width, bmpConnection_height, ConnectionStateallArray[1]);
-
-    // Send the buffer content to the display
-    display.sendBuffer();
+    trace(TRACE_SCREEN, SCREEN_WAITING);
+    showScene(WAITING_SCENE);
 }
 
 /**
@@ -172,17 +561,8 @@ void waitingScreen()
  */
 void readyScreen()
 {
-    // Clear the display buffer
-    display.clearBuffer();
-
-    // Draw the status screen
-    statusScreen();
-
-    // Draw the bitmap at the specified position
-    display.drawXBMP(4, 38, bmpConnection_width, bmpConnection_height, ConnectionStateallArray[0]);
-
-    // Send the buffer content to the display
-    display.sendBuffer();
+    trace(TRACE_SCREEN, SCREEN_READY);
+    showScene(READY_SCENE);
 }
 
 /**
@@ -190,21 +570,8 @@ void readyScreen()
  */
 void startingScreen()
 {
-    // Clear the display buffer
-    display.clearBuffer();
-
-    // Draw the status screen
-    statusScreen();
-
-    // Draw the rocket bitmap at the specified positions
-    display.drawXBMP(6, 39, bmpRocket_width, bmpRocket_height, bmpRocket);
-    display.drawXBMP(109, 39, bmpRocket_width, bmpRocket_height, bmpRocket);
-
-    // Draw the "Starting" bitmap at the specified position
-    display.drawXBMP(25, 43, bmpStarting_width, bmpStarting_height, bmpStarting);
-
-    // Send the buffer content to the display
-    display.sendBuffer();
+    trace(TRACE_SCREEN, SCREEN_STARTING);
+    showScene(STARTING_SCENE);
 }
 
 /**
@@ -212,21 +579,8 @@ void startingScreen()
  */
 void stoppingScreen()
 {
-    // Clear the display buffer
-    display.clearBuffer();
-
-    // Draw the status screen
-    statusScreen();
-
-    // Draw the ZZZ bitmap at the specified positions
-    display.drawXBMP(4, 41, bmpZZZ_width, bmpZZZ_height, bmpZZZ);
-    display.drawXBMP(107, 41, bmpZZZ_width, bmpZZZ_height, bmpZZZ);
-
-    // Draw the "Stopping" bitmap at the specified position
-    display.drawXBMP(24, 43, bmpStopping_width, bmpStopping_height, bmpStopping);
-
-    // Send the buffer content to the display
-    display.sendBuffer();
+    trace(TRACE_SCREEN, SCREEN_STOPPING);
+    showScene(STOPPING_SCENE);
 }
 
 /**
@@ -234,19 +588,6 @@ void stoppingScreen()
  */
 void stoppedScreen()
 {
-    // Clear the display buffer
-    display.clearBuffer();
-
-    // Draw the status screen
-    statusScreen();
-
-    // Draw the "Bye" bitmap at the specified positions
-    display.drawXBMP(4, 42, bmpBye_width, bmpBye_height, bmpBye);
-    display.drawXBMP(104, 42, bmpBye_width, bmpBye_height, bmpBye);
-
-    // Draw the "Stopped" bitmap at the specified position
-    display.drawXBMP(27, 43, bmpStopped_width, bmpStopped_height, bmpStopped);
-
-    // Send the buffer content to the display
-    display.sendBuffer();
+    trace(TRACE_SCREEN, SCREEN_STOPPED);
+    showScene(STOPPED_SCENE);
 }
@@ -0,0 +1,148 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file bringUp.cpp
+ * @brief Source file for the non-blocking joystick bring-up sequence.
+ *
+ * The sequence used to be a loop of delay() calls blocking the serial handling for 12 seconds.
+ * It is now a small state machine advanced by serviceBringUp(), each step being scheduled relative
+ * to the previous one so the relay timing stays the same.
+ */
+
+#include "bringUp.h"
+#include "bitmapManager.h"
+#include "ledStatus.h"
+#include "relayBank.h"
+#include "binaryProtocol.h"
+#include "controller.h"
+#include "trace.h"
+
+/**
+ * @enum BringUpStep
+ * @brief Next step of the bring-up sequence.
+ */
+enum BringUpStep
+{
+    BRINGUP_IDLE,              ///< Sequence not running.
+    BRINGUP_CONNECT_JOYSTICK,  ///< Show the progress and connect the joystick.
+    BRINGUP_CONNECT_LEDS,      ///< Connect the button LEDs of the joystick.
+    BRINGUP_NEXT_JOYSTICK      ///< Move on to the next joystick, or finish.
+};
+
+/// Next step to run
+static BringUpStep step = BRINGUP_IDLE;
+
+/// Joystick being connected, from 1 to 4
+static int currentJoystick = 0;
+
+/// Time at which the next step is due
+static unsigned long nextStepTime = 0;
+
+/**
+ * @brief Starts the joystick bring-up sequence.
+ *
+ * Does nothing if the sequence is already running.
+ */
+void startBringUp()
+{
+    if (step != BRINGUP_IDLE)
+    {
+        return;
+    }
+
+    currentJoystick = 1;
+    step = BRINGUP_CONNECT_JOYSTICK;
+    nextStepTime = millis();
+}
+
+/**
+ * @brief Checks whether the joystick bring-up sequence is running.
+ */
+bool bringUpRunning()
+{
+    return step != BRINGUP_IDLE;
+}
+
+/**
+ * @brief Runs the bring-up steps that are due.
+ *
+ * The delay after a relay step counts from the time the step ran, so a late call never switches two
+ * relays back to back.
+ *
+ * @return Time until the next step in milliseconds, portMAX_DELAY if the sequence is not running.
+ */
+uint32_t serviceBringUp()
+{
+    while (step != BRINGUP_IDLE)
+    {
+        long remaining = (long)(nextStepTime - millis());
+        if (remaining > 0)
+        {
+            return (uint32_t)remaining;
+        }
+
+        switch (step)
+        {
+        case BRINGUP_CONNECT_JOYSTICK:
+            // Show the progress of this joystick
+            trace(TRACE_SCREEN, SCREEN_PROGRESS, currentJoystick);
+            progressScreen(currentJoystick * 25);
+
+            // Physically reconnect the joystick
+            relays.set(currentJoystick * 2 - 2, true);
+            nextStepTime = millis() + BRINGUP_RELAY_DELAY_MS;
+            step = BRINGUP_CONNECT_LEDS;
+            break;
+
+        case BRINGUP_CONNECT_LEDS:
+            // Physically reconnect the buttons LEDs
+            relays.set(currentJoystick * 2 - 1, true);
+            console.print("INIT:");
+            console.println(currentJoystick);
+            nextStepTime = millis() + BRINGUP_SETTLE_DELAY_MS;
+            step = BRINGUP_NEXT_JOYSTICK;
+            break;
+
+        case BRINGUP_NEXT_JOYSTICK:
+            if (currentJoystick < 4)
+            {
+                currentJoystick++;
+                step = BRINGUP_CONNECT_JOYSTICK;
+            }
+            else
+            {
+                step = BRINGUP_IDLE;
+                controllerDispatch(EV_BRINGUP_DONE);
+                console.println("INIT:DONE");
+            }
+            break;
+
+        default:
+            step = BRINGUP_IDLE;
+            break;
+        }
+    }
+    return portMAX_DELAY;
+}
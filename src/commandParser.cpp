@@ -0,0 +1,177 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file commandParser.cpp
+ * @brief Source file for the allocation-free serial command parser.
+ *
+ * This file contains the ring buffer management and the line tokenizer used by the main loop
+ * to decode the text protocol without creating any String object.
+ */
+
+#include "commandParser.h"
+#include <limits.h>
+
+/// Mask used to wrap free running indexes onto the ring.
+static const uint16_t RING_MASK = CommandParser::RING_SIZE - 1;
+
+/**
+ * @brief Checks whether a character is a whitespace, as String::trim() does.
+ */
+static bool isBlank(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\f' || c == '\v';
+}
+
+bool Command::equals(const char *str) const
+{
+    size_t len = strlen(str);
+    return len == length && memcmp(text, str, len) == 0;
+}
+
+/**
+ * @brief Fills the command from a line of text.
+ *
+ * The line is trimmed and its integer argument is decoded the same way String::toInt() did:
+ * leading blanks and an optional sign are accepted, parsing stops at the first non digit. A number
+ * too large for an int is clamped to INT_MAX instead of overflowing.
+ *
+ * @param line First character of the line.
+ * @param lineLength Number of characters in the line, without the newline.
+ */
+void Command::parse(const char *line, uint16_t lineLength)
+{
+    while (lineLength > 0 && isBlank(line[0]))
+    {
+        line++;
+        lineLength--;
+    }
+    while (lineLength > 0 && isBlank(line[lineLength - 1]))
+    {
+        lineLength--;
+    }
+
+    text = line;
+    length = (uint8_t)lineLength;
+    event = lineLength > 0 ? line[0] : 0;
+    seq = -1;
+
+    // Extract the integer after the separator, or from the start when there is none
+    const char *p = (const char *)memchr(line, ':', lineLength);
+    p = (p != NULL) ? p + 1 : line;
+    const char *last = line + lineLength;
+    while (p < last && isBlank(*p))
+    {
+        p++;
+    }
+    bool negative = false;
+    if (p < last && (*p == '-' || *p == '+'))
+    {
+        negative = (*p == '-');
+        p++;
+    }
+    int number = 0;
+    while (p < last && *p >= '0' && *p <= '9')
+    {
+        int digit = *p - '0';
+        number = (number > (INT_MAX - digit) / 10) ? INT_MAX : number * 10 + digit;
+        p++;
+    }
+    value = negative ? -number : number;
+}
+
+/**
+ * @brief Appends a received byte to the ring.
+ *
+ * Complete lines live between tail and scan, the line being received lives between scan and head.
+ * Only the line being received counts as too long: when it fills the whole ring it is dropped and
+ * the following bytes are ignored until the next newline. When unread complete lines take part of
+ * the room the byte is refused instead, so complete lines are never overwritten or lost.
+ *
+ * @param c The received byte.
+ * @return false if the byte was refused because the ring is full of unread lines.
+ */
+bool CommandParser::push(char c)
+{
+    if (discarding)
+    {
+        discarding = (c != '\n');
+        return true;
+    }
+
+    if ((uint16_t)(head - tail) >= RING_SIZE)
+    {
+        if (pendingLines > 0)
+        {
+            // Room is freed once the complete lines are taken out
+            return false;
+        }
+
+        // Line too long: drop what was received of it
+        head = scan;
+        discarding = (c != '\n');
+        overflows++;
+        return true;
+    }
+
+    uint16_t index = head & RING_MASK;
+    ring[index] = c;
+    ring[index + RING_SIZE] = c;
+    head++;
+
+    if (c == '\n')
+    {
+        scan = head;
+        pendingLines++;
+    }
+    return true;
+}
+
+/**
+ * @brief Extracts the next complete line from the ring.
+ *
+ * @param cmd Command filled with a view of the line.
+ * @return true if a line was available.
+ */
+bool CommandParser::next(Command &cmd)
+{
+    if (pendingLines == 0)
+    {
+        return false;
+    }
+
+    uint16_t start = tail;
+    uint16_t end = start;
+    while (ring[end & RING_MASK] != '\n')
+    {
+        end++;
+    }
+    tail = end + 1;
+    pendingLines--;
+
+    // The mirror makes the whole line contiguous from its first byte
+    cmd.parse(&ring[start & RING_MASK], end - start);
+
+    return true;
+}
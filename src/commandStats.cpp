@@ -0,0 +1,184 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file commandStats.cpp
+ * @brief Source file for the per-command latency histograms.
+ *
+ * This file contains the histogram storage, the stage recording and the STATS? dump.
+ */
+
+#include "commandStats.h"
+#include "controller.h"
+#include "serialReceiver.h"
+#include "binaryProtocol.h"
+#include <esp_timer.h>
+
+/**
+ * @brief Latency histogram of a stage of a command type.
+ */
+struct Histogram
+{
+    uint32_t buckets[STATS_BUCKETS]; ///< Number of latencies in each power of two bucket.
+    uint32_t count;                  ///< Number of latencies recorded.
+    uint32_t max;                    ///< Largest latency recorded, in microseconds.
+};
+
+/// Histograms indexed by command type and stage, the frame stage is only written by the render task
+static Histogram histograms[EV_COUNT][STAGE_COUNT];
+
+/// Command being handled by the loop task
+static StatsContext current = {STATS_NO_COMMAND, 0};
+
+/// Names of the command types, indexed by ControllerEvent
+static const char *const COMMAND_NAMES[EV_COUNT] = {"ESP32?", "INIT", "N", "S", "D", "E", "P"};
+
+/// Names of the stages
+static const char *const STAGE_NAMES[STAGE_COUNT] = {"ack", "relay", "frame"};
+
+/**
+ * @brief Starts timing a command received with the last UART receive event.
+ * @param command ControllerEvent of the command.
+ */
+void statsBeginCommand(uint8_t command)
+{
+    current.command = command;
+    current.start = rxEventTimestamp();
+}
+
+/**
+ * @brief Stops attaching the following stages to the last command.
+ */
+void statsEndCommand()
+{
+    current.command = STATS_NO_COMMAND;
+}
+
+/**
+ * @brief Context of the command being handled, to time a stage completed later by another task.
+ */
+StatsContext statsContext()
+{
+    return current;
+}
+
+/**
+ * @brief Records a stage of the command being handled.
+ * @param stage The stage completed.
+ */
+void statsRecord(StatsStage stage)
+{
+    statsRecord(current, stage);
+}
+
+/**
+ * @brief Records a stage of a command.
+ *
+ * The bucket is the position of the highest bit set in the latency, found with a single count
+ * leading zeros instruction.
+ *
+ * @param context Context of the command, nothing is recorded for STATS_NO_COMMAND.
+ * @param stage The stage completed.
+ */
+void statsRecord(const StatsContext &context, StatsStage stage)
+{
+    if (context.command >= EV_COUNT)
+    {
+        return;
+    }
+
+    int64_t elapsed = esp_timer_get_time() - context.start;
+    uint32_t latency = (elapsed < 0) ? 0 : (elapsed > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32_t)elapsed;
+    uint8_t bucket = 31 - __builtin_clz(latency | 1);
+    if (bucket >= STATS_BUCKETS)
+    {
+        bucket = STATS_BUCKETS - 1;
+    }
+
+    Histogram &histogram = histograms[context.command][stage];
+    histogram.buckets[bucket]++;
+    histogram.count++;
+    if (latency > histogram.max)
+    {
+        histogram.max = latency;
+    }
+}
+
+/**
+ * @brief Prints the histograms that are not empty, then STATS:END.
+ *
+ * Output format, one line per histogram:
+ * STATS:<command>:<stage>:n=<count>,max=<us>,hist=<bucket 0>,<bucket 1>,...
+ * where bucket n counts the latencies from 2^n to 2^(n+1)-1 us, trailing empty buckets omitted.
+ */
+void printCommandStats()
+{
+    for (int command = 0; command < EV_COUNT; command++)
+    {
+        for (int stage = 0; stage < STAGE_COUNT; stage++)
+        {
+            const Histogram &histogram = histograms[command][stage];
+            if (histogram.count == 0)
+            {
+                continue;
+            }
+
+            console.print("STATS:");
+            console.print(COMMAND_NAMES[command]);
+            console.print(':');
+            console.print(STAGE_NAMES[stage]);
+            console.print(":n=");
+            console.print(histogram.count);
+            console.print(",max=");
+            console.print(histogram.max);
+            console.print(",hist=");
+
+            int last = STATS_BUCKETS - 1;
+            while (last > 0 && histogram.buckets[last] == 0)
+            {
+                last--;
+            }
+            for (int bucket = 0; bucket <= last; bucket++)
+            {
+                if (bucket > 0)
+                {
+                    console.print(',');
+                }
+                console.print(histogram.buckets[bucket]);
+            }
+            console.println();
+        }
+    }
+    console.println("STATS:END");
+}
+
+/**
+ * @brief Empties all histograms.
+ *
+ * A frame stage recorded by the render task during the reset may be lost.
+ */
+void resetCommandStats()
+{
+    memset(histograms, 0, sizeof(histograms));
+}
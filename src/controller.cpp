@@ -0,0 +1,318 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file controller.cpp
+ * @brief Source file for the controller state machine.
+ *
+ * This file contains the transition table, the actions run on transitions and the time-in-state
+ * statistics.
+ */
+
+#include "controller.h"
+#include "bitmapManager.h"
+#include "ledStatus.h"
+#include "bringUp.h"
+#include "serialReceiver.h"
+#include "binaryProtocol.h"
+#include "trace.h"
+
+/**
+ * @brief Entry of the transition table.
+ */
+struct Transition
+{
+    bool accepted;            ///< Whether the event is valid in the state.
+    ControllerState next;     ///< State after the event.
+    void (*action)(int);      ///< Action run after entering the next state, NULL for none.
+};
+
+/// Whether a player count update is waiting to be rendered
+static bool playersPending = false;
+
+/// Player count of the last EV_PLAYERS event
+static int pendingPlayers = 0;
+
+/**
+ * @brief Starts reconnecting the joysticks.
+ */
+static void actionStartBringUp(int)
+{
+    startBringUp();
+}
+
+/**
+ * @brief Shows that the joysticks are connected.
+ */
+static void actionReady(int)
+{
+    readyScreen();
+}
+
+/**
+ * @brief Records the number of players, rendered later by flushPlayers().
+ * @param players The number of players.
+ */
+static void actionPlayers(int players)
+{
+    // A previous update of the same batch will never be shown
+    if (playersPending)
+    {
+        markCoalesced();
+    }
+    playersPending = true;
+    pendingPlayers = players;
+}
+
+/**
+ * @brief Shows the starting screen and disconnects the buttons LEDs.
+ */
+static void actionStarting(int)
+{
+    startingScreen();
+    activateLeds(0);
+}
+
+/**
+ * @brief Shows the stopping screen and connects all buttons LEDs.
+ */
+static void actionStopping(int)
+{
+    stoppingScreen();
+    activateLeds(4);
+}
+
+/**
+ * @brief Shows the stopped screen and disconnects the buttons LEDs.
+ */
+static void actionStopped(int)
+{
+    stoppedScreen();
+    activateLeds(0);
+}
+
+/// Transition rejecting the event
+#define REJECT(state) {false, state, NULL}
+
+/// Transition accepting the event
+#define ACCEPT(state, action) {true, state, action}
+
+/// Transition table, indexed by state then event
+static constexpr Transition TRANSITIONS[STATE_COUNT][EV_COUNT] = {
+    // STATE_WAITING
+    {
+        ACCEPT(STATE_CONFIG, actionStartBringUp), // EV_HANDSHAKE
+        REJECT(STATE_WAITING),                    // EV_BRINGUP_DONE
+        REJECT(STATE_WAITING),                    // EV_PLAYERS
+        ACCEPT(STATE_WAITING, actionStarting),    // EV_STARTING
+        ACCEPT(STATE_WAITING, actionStarting),    // EV_STARTED
+        ACCEPT(STATE_WAITING, actionStopping),    // EV_STOPPING
+        ACCEPT(STATE_WAITING, actionStopped),     // EV_STOPPED
+    },
+    // STATE_CONFIG
+    {
+        ACCEPT(STATE_CONFIG, NULL),               // EV_HANDSHAKE, retried by the frontend
+        ACCEPT(STATE_READY, actionReady),         // EV_BRINGUP_DONE
+        REJECT(STATE_CONFIG),                     // EV_PLAYERS
+        REJECT(STATE_CONFIG),                     // EV_STARTING
+        REJECT(STATE_CONFIG),                     // EV_STARTED
+        REJECT(STATE_CONFIG),                     // EV_STOPPING
+        REJECT(STATE_CONFIG),                     // EV_STOPPED
+    },
+    // STATE_READY
+    {
+        ACCEPT(STATE_CONFIG, actionStartBringUp), // EV_HANDSHAKE
+        REJECT(STATE_READY),                      // EV_BRINGUP_DONE
+        ACCEPT(STATE_READY, actionPlayers),       // EV_PLAYERS
+        ACCEPT(STATE_READY, actionStarting),      // EV_STARTING
+        ACCEPT(STATE_READY, actionStarting),      // EV_STARTED
+        ACCEPT(STATE_READY, actionStopping),      // EV_STOPPING
+        ACCEPT(STATE_READY, actionStopped),       // EV_STOPPED
+    },
+};
+
+/**
+ * @brief Checks that a rejected event never changes the state.
+ */
+static constexpr bool rejectsStay(int index = 0)
+{
+    return index == STATE_COUNT * EV_COUNT ||
+           ((TRANSITIONS[index / EV_COUNT][index % EV_COUNT].accepted ||
+             TRANSITIONS[index / EV_COUNT][index % EV_COUNT].next == index / EV_COUNT) &&
+            rejectsStay(index + 1));
+}
+static_assert(rejectsStay(), "A rejected event must leave the state unchanged");
+
+/// LED pattern of each state
+static const LedStatus STATE_LEDS[STATE_COUNT] = {WAITING, CONFIG, READY};
+
+/// Names of the states, for the statistics
+static const char *const STATE_NAMES[STATE_COUNT] = {"WAITING", "CONFIG", "READY"};
+
+/// Current state
+static ControllerState state = STATE_WAITING;
+
+/// Value of millis() when the current state was entered
+static unsigned long stateEnterTime = 0;
+
+/// Time spent in each state before the current one was entered, in milliseconds
+static unsigned long stateTime[STATE_COUNT] = {0, 0, 0};
+
+/// Number of times each state was entered
+static uint32_t stateEntries[STATE_COUNT] = {1, 0, 0};
+
+/// Number of events rejected
+static uint32_t rejectedEvents = 0;
+
+/**
+ * @brief Gives the event of a command letter.
+ *
+ * @param event First character of the command.
+ * @return The event, EV_COUNT if the letter is not a controller command.
+ */
+ControllerEvent commandEvent(char event)
+{
+    switch (event)
+    {
+    case 'N':
+    case 'L':
+    case 'Q':
+        return EV_PLAYERS;
+    case 'S':
+        return EV_STARTING;
+    case 'D':
+        return EV_STARTED;
+    case 'E':
+        return EV_STOPPING;
+    case 'P':
+        return EV_STOPPED;
+    default:
+        return EV_COUNT;
+    }
+}
+
+/**
+ * @brief Checks whether an event is valid in the current state.
+ * @param event The event.
+ */
+bool controllerAccepts(ControllerEvent event)
+{
+    return TRANSITIONS[state][event].accepted;
+}
+
+/**
+ * @brief Feeds an event to the state machine.
+ *
+ * On a state change the time spent in the previous state is accounted and the LED pattern of the
+ * new state is started before the action runs, so the action draws the screens of the new state.
+ *
+ * @param event The event.
+ * @param value Argument of the event, the number of players for EV_PLAYERS.
+ * @return false if the event is not valid in the current state, nothing is done then.
+ */
+bool controllerDispatch(ControllerEvent event, int value)
+{
+    const Transition &transition = TRANSITIONS[state][event];
+    if (!transition.accepted)
+    {
+        rejectedEvents++;
+        return false;
+    }
+
+    if (transition.next != state)
+    {
+        unsigned long now = millis();
+        stateTime[state] += now - stateEnterTime;
+        stateEnterTime = now;
+        state = transition.next;
+        stateEntries[state]++;
+        trace(TRACE_STATE, state);
+        setLedStatus(STATE_LEDS[state]);
+    }
+
+    if (transition.action != NULL)
+    {
+        transition.action(value);
+    }
+    return true;
+}
+
+/**
+ * @brief Current state of the controller.
+ */
+ControllerState controllerState()
+{
+    return state;
+}
+
+/**
+ * @brief Renders the player count left by the last EV_PLAYERS event, if not done yet.
+ *
+ * The joystick screen is drawn once and the LED relays are switched straight to their final state,
+ * whatever the number of updates received.
+ */
+void flushPlayers()
+{
+    if (!playersPending)
+    {
+        return;
+    }
+    playersPending = false;
+
+    joystickScreen(pendingPlayers);
+    activateLeds(pendingPlayers);
+}
+
+/**
+ * @brief Prints the time spent in each state and the number of rejected events, then restarts the statistics.
+ *
+ * Output format: STATE:current=<name>,WAITING=<ms>/<entries>,CONFIG=<ms>/<entries>,READY=<ms>/<entries>,rejected=<n>
+ */
+void printStateStats()
+{
+    unsigned long now = millis();
+    stateTime[state] += now - stateEnterTime;
+    stateEnterTime = now;
+
+    console.print("STATE:current=");
+    console.print(STATE_NAMES[state]);
+    for (int s = 0; s < STATE_COUNT; s++)
+    {
+        console.print(',');
+        console.print(STATE_NAMES[s]);
+        console.print('=');
+        console.print(stateTime[s]);
+        console.print('/');
+        console.print(stateEntries[s]);
+    }
+    console.print(",rejected=");
+    console.println(rejectedEvents);
+
+    for (int s = 0; s < STATE_COUNT; s++)
+    {
+        stateTime[s] = 0;
+        stateEntries[s] = (s == state) ? 1 : 0;
+    }
+    rejectedEvents = 0;
+}
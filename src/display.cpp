@@ -31,6 +31,7 @@
  */
 
 #include "display.h"
+#include "trace.h"
 
 /**
  * @brief Global instance of the CustomDisplay class used to manage the OLED display.
@@ -122,3 +123,443 @@ void CustomDisplay::drawProgressBar(uint16_t x, uint16_t y, uint16_t width, uint
         drawDisc(xRadius + maxProgressWidth, yRadius, radius - 1, U8G2_DRAW_ALL);
     }
 }
+
+/**
+ * @brief Transposes an 8x8 block of pixels held in two 32-bit words.
+ *
+ * On entry byte i of the block (byte i & 3 of rows0to3 or rows4to7) is row i, with column j in bit j,
+ * as in an XBM row. On return byte j is column j, with row i in bit i, as in a page of the buffer.
+ * Each step swaps the two off-diagonal quarters of the 2x2, 4x4 and 8x8 sub blocks with a masked
+ * exchange, so the whole block takes a dozen word operations instead of 64 pixel tests.
+ *
+ * @param rows0to3 Rows 0 to 3, replaced by columns 0 to 3.
+ * @param rows4to7 Rows 4 to 7, replaced by columns 4 to 7.
+ */
+static inline void transpose8x8(uint32_t &rows0to3, uint32_t &rows4to7)
+{
+    uint32_t t;
+    t = (rows0to3 ^ (rows0to3 >> 7)) & 0x00AA00AA;
+    rows0to3 ^= t ^ (t << 7);
+    t = (rows4to7 ^ (rows4to7 >> 7)) & 0x00AA00AA;
+    rows4to7 ^= t ^ (t << 7);
+
+    t = (rows0to3 ^ (rows0to3 >> 14)) & 0x0000CCCC;
+    rows0to3 ^= t ^ (t << 14);
+    t = (rows4to7 ^ (rows4to7 >> 14)) & 0x0000CCCC;
+    rows4to7 ^= t ^ (t << 14);
+
+    t = (rows0to3 ^ (rows4to7 << 4)) & 0xF0F0F0F0;
+    rows0to3 ^= t;
+    rows4to7 ^= t >> 4;
+}
+
+/**
+ * @brief Writes a strip of up to 8 XBM rows into the buffer, 8x8 block by 8x8 block.
+ *
+ * Each block is transposed into 8 column bytes. When the strip is page aligned and complete, they
+ * are stored as two words over whole page bytes. Otherwise the bytes are shifted into the page of the
+ * top of the strip and the next one, keeping the pixels of the rows outside the strip. Pages outside
+ * the buffer are skipped.
+ *
+ * @param x The X-coordinate of the left column, the strip being clipped to the buffer by the caller.
+ * @param top The Y-coordinate of the first row of the strip.
+ * @param width The number of columns to write.
+ * @param rowMask The rows of the strip to write, bit i for row i.
+ * @param strip The rows, (width + 7) / 8 bytes used in each.
+ */
+void CustomDisplay::drawStrip(uint8_t x, int top, uint8_t width, uint8_t rowMask, const uint8_t (*strip)[STRIP_BYTES])
+{
+    uint16_t rowSize = getBufferTileWidth() * 8;
+    int page = (top >> 3) - getBufferCurrTileRow();
+    int pages = getBufferTileHeight();
+    uint8_t shift = top & 7;
+    uint8_t lowMask = rowMask << shift;
+    uint8_t highMask = shift ? rowMask >> (8 - shift) : 0;
+    uint8_t *low = (page >= 0 && page < pages) ? getBufferPtr() + page * rowSize + x : NULL;
+    uint8_t *high = (highMask && page + 1 >= 0 && page + 1 < pages) ? getBufferPtr() + (page + 1) * rowSize + x : NULL;
+    if (low == NULL && high == NULL)
+    {
+        return;
+    }
+
+    for (uint8_t column = 0; column < width; column += 8)
+    {
+        uint8_t block = column / 8;
+        uint32_t words[2];
+        words[0] = strip[0][block] | (strip[1][block] << 8) | (strip[2][block] << 16) | ((uint32_t)strip[3][block] << 24);
+        words[1] = strip[4][block] | (strip[5][block] << 8) | (strip[6][block] << 16) | ((uint32_t)strip[7][block] << 24);
+        transpose8x8(words[0], words[1]);
+
+        uint8_t count = (width - column < 8) ? width - column : 8;
+        if (lowMask == 0xff && count == 8)
+        {
+            // Page aligned full block: whole page bytes, column j being byte j of the little endian words
+            memcpy(low + column, words, 8);
+            continue;
+        }
+        for (uint8_t i = 0; i < count; i++)
+        {
+            uint8_t bits = words[i >> 2] >> ((i & 3) * 8);
+            if (low != NULL)
+            {
+                low[column + i] = (low[column + i] & ~lowMask) | ((bits << shift) & lowMask);
+            }
+            if (high != NULL)
+            {
+                high[column + i] = (high[column + i] & ~highMask) | ((bits >> (8 - shift)) & highMask);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Draws an XBM bitmap, through drawStrip() in the default drawing state.
+ *
+ * With draw color 1 in solid bitmap mode, which every screen uses, the bitmap is read 8 rows at a time
+ * and written with drawStrip(), at any position: in the SSD1306 buffer layout every x is byte
+ * aligned and a y off a page boundary only shifts the column bytes. Same result as U8G2::drawXBMP(),
+ * which is called for the other drawing states and for bitmaps starting outside the display.
+ *
+ * @param x The X-coordinate of the left column.
+ * @param y The Y-coordinate of the top row.
+ * @param w The width of the bitmap in pixels.
+ * @param h The height of the bitmap in pixels.
+ * @param bitmap The XBM bitmap, in PROGMEM.
+ */
+void CustomDisplay::drawXBMP(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap)
+{
+    const u8g2_t *state = getU8g2();
+    if (state->draw_color != 1 || state->bitmap_transparency != 0 || x >= getDisplayWidth() ||
+        y >= getDisplayHeight() || w > 255 || h > 255)
+    {
+        DisplayBase::drawXBMP(x, y, w, h, bitmap);
+        return;
+    }
+
+    uint8_t strip[8][STRIP_BYTES];
+    uint8_t rowBytes = (w + 7) / 8;
+    uint8_t visibleWidth = (x + w > getDisplayWidth()) ? getDisplayWidth() - x : w;
+    uint8_t stripBytes = (visibleWidth + 7) / 8;
+    int bufferTop = getBufferCurrTileRow() * 8;
+    int bufferBottom = bufferTop + getBufferTileHeight() * 8;
+
+    for (uint8_t top = 0; top < h && y + top < bufferBottom; top += 8)
+    {
+        uint8_t rows = (h - top < 8) ? h - top : 8;
+        if (y + top + rows <= bufferTop)
+        {
+            continue;
+        }
+        for (uint8_t row = 0; row < 8; row++)
+        {
+            if (row < rows)
+            {
+                memcpy_P(strip[row], bitmap + (top + row) * rowBytes, stripBytes);
+            }
+            else
+            {
+                memset(strip[row], 0, stripBytes);
+            }
+        }
+        drawStrip(x, y + top, visibleWidth, 0xff >> (8 - rows), strip);
+    }
+}
+
+/**
+ * @brief Decodes a packed bitmap straight into the buffer.
+ *
+ * A tile is 8 columns of 8 pixels laid out like 8 bytes of a page of the U8g2 buffer, so each tile of
+ * an ASSET_TILES bitmap is copied as is. The run length encoded bytes of an ASSET_XBM bitmap are read
+ * once, in order, 8 rows at a time written with drawStrip(). The strips outside the buffer are
+ * skipped, and decoding stops past its last page. An ASSET_TILES bitmap at a y that is not a multiple
+ * of 8 is not drawn, its tiles cannot be copied across two pages.
+ *
+ * @param x The X-coordinate of the left column.
+ * @param y The Y-coordinate of the top row.
+ * @param asset The bitmap, see assetStore.h.
+ */
+void CustomDisplay::drawAsset(uint8_t x, uint8_t y, const PackedAsset &asset)
+{
+    uint8_t *buffer = getBufferPtr();
+    uint16_t rowSize = getBufferTileWidth() * 8;
+    int bufferTop = getBufferCurrTileRow() * 8;
+    int bufferBottom = bufferTop + getBufferTileHeight() * 8;
+    const uint8_t *data = ASSET_BLOB + asset.offset;
+
+    if (x >= rowSize)
+    {
+        return;
+    }
+    uint8_t visibleWidth = (x + asset.width > rowSize) ? rowSize - x : asset.width;
+
+    if (asset.format == ASSET_TILES)
+    {
+        if (y % 8 != 0)
+        {
+            return;
+        }
+        uint8_t tilesPerRow = asset.width / 8;
+        for (uint8_t top = 0; top < asset.height && y + top < bufferBottom; top += 8, data += tilesPerRow)
+        {
+            if (y + top < bufferTop)
+            {
+                continue;
+            }
+            uint8_t *page = buffer + ((y + top - bufferTop) >> 3) * rowSize + x;
+            for (uint8_t column = 0; column < visibleWidth; column += 8)
+            {
+                const uint8_t *tile = ASSET_BLOB + pgm_read_byte(data + column / 8) * ASSET_TILE_SIZE;
+                memcpy_P(page + column, tile, min((uint8_t)(visibleWidth - column), ASSET_TILE_SIZE));
+            }
+        }
+        return;
+    }
+
+    RleReader reader(data);
+    uint8_t strip[8][STRIP_BYTES];
+    uint8_t rowBytes = (asset.width + 7) / 8;
+    uint8_t stripBytes = (visibleWidth + 7) / 8;
+    for (uint8_t top = 0; top < asset.height && y + top < bufferBottom; top += 8)
+    {
+        uint8_t rows = (asset.height - top < 8) ? asset.height - top : 8;
+        if (y + top + rows <= bufferTop)
+        {
+            reader.skip(rows * rowBytes);
+            continue;
+        }
+        for (uint8_t row = 0; row < 8; row++)
+        {
+            if (row >= rows)
+            {
+                memset(strip[row], 0, stripBytes);
+                continue;
+            }
+            for (uint8_t i = 0; i < stripBytes; i++)
+            {
+                strip[row][i] = reader.next();
+            }
+            reader.skip(rowBytes - stripBytes);
+        }
+        drawStrip(x, y + top, visibleWidth, 0xff >> (8 - rows), strip);
+    }
+}
+
+/**
+ * @brief Initializes the display.
+ *
+ * The panel content is unknown after a reset, so the next frame is sent in full.
+ *
+ * @return The result of the base class begin().
+ */
+bool CustomDisplay::begin()
+{
+    invalidate();
+    return DisplayBase::begin();
+}
+
+#ifdef DISPLAY_PAGE_MODE
+
+/**
+ * @brief No render task in page mode, the frames are sent by the task drawing them.
+ *
+ * The frame would have to be kept in RAM until the transfer is over, which is what page mode avoids.
+ */
+void CustomDisplay::startRenderTask()
+{
+}
+
+/**
+ * @brief Draws a screen page by page and sends each page to the panel.
+ *
+ * @param draw The draw list, NULL for a blank screen.
+ */
+void CustomDisplay::render(DrawList draw)
+{
+    unsigned long start = micros();
+    trace(TRACE_FRAME_BEGIN);
+
+    firstPage();
+    do
+    {
+        if (draw != NULL)
+        {
+            draw();
+        }
+        transfers++;
+    } while (nextPage());
+
+    bytesSent += FRAME_SIZE;
+    frames++;
+    trace(TRACE_FRAME_END, 0, FRAME_SIZE);
+    lastFrameUs = micros() - start;
+    totalFrameUs += lastFrameUs;
+    statsRecord(STAGE_FRAME);
+}
+
+#else
+
+/**
+ * @brief Draws a screen on a blank frame and sends it to the panel.
+ *
+ * @param draw The draw list, NULL for a blank screen.
+ */
+void CustomDisplay::render(DrawList draw)
+{
+    clearBuffer();
+    if (draw != NULL)
+    {
+        draw();
+    }
+    sendBuffer();
+}
+
+/// Protects the frame buffer indexes shared with the render task
+static portMUX_TYPE frameLock = portMUX_INITIALIZER_UNLOCKED;
+
+/**
+ * @brief Creates the render task, which then owns all transfers to the panel.
+ *
+ * The task runs on core 0, the Arduino loop and the LED task running on core 1.
+ */
+void CustomDisplay::startRenderTask()
+{
+    xTaskCreatePinnedToCore(
+        renderTask,        // Task function
+        "Render",          // Task name
+        4096,              // Stack size
+        this,              // Task parameter
+        1,                 // Task priority
+        &renderTaskHandle, // Task handle
+        0);                // CPU core to run the task
+}
+
+/**
+ * @brief Sends the tiles of the buffer that differ from the last frame sent.
+ *
+ * When the render task runs, the buffer is copied into the frame buffer that is not being sent and
+ * the render task is notified. A frame still waiting is withdrawn and counted as dropped. The lock
+ * is only held to claim and to publish the buffer, never during the copy.
+ */
+void CustomDisplay::sendBuffer()
+{
+    if (renderTaskHandle == NULL)
+    {
+        flushFrame(getBufferPtr());
+        statsRecord(STAGE_FRAME);
+        return;
+    }
+
+    // Claim the buffer that is not being sent, withdrawing the frame still waiting so that the render
+    // task cannot take it during the copy, which is done outside the lock
+    portENTER_CRITICAL(&frameLock);
+    int8_t index = (flushingIndex == 0) ? 1 : 0;
+    if (pendingIndex >= 0)
+    {
+        pendingIndex = -1;
+        dropped++;
+    }
+    portEXIT_CRITICAL(&frameLock);
+
+    memcpy(frameBuffers[index], getBufferPtr(), FRAME_SIZE);
+    frameContexts[index] = statsContext();
+
+    portENTER_CRITICAL(&frameLock);
+    pendingIndex = index;
+    portEXIT_CRITICAL(&frameLock);
+
+    xTaskNotifyGive(renderTaskHandle);
+}
+
+/**
+ * @brief Render task function, flushes the submitted frames.
+ *
+ * Only the most recent frame is sent, the frame buffer it sits in is left alone by sendBuffer()
+ * until the transfer is over.
+ *
+ * @param pvParameters Pointer to the CustomDisplay instance.
+ */
+void CustomDisplay::renderTask(void *pvParameters)
+{
+    CustomDisplay *self = (CustomDisplay *)pvParameters;
+
+    while (1)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        portENTER_CRITICAL(&frameLock);
+        int8_t index = self->pendingIndex;
+        self->flushingIndex = index;
+        self->pendingIndex = -1;
+        portEXIT_CRITICAL(&frameLock);
+
+        if (index < 0)
+        {
+            continue;
+        }
+
+        self->flushFrame(self->frameBuffers[index]);
+        statsRecord(self->frameContexts[index], STAGE_FRAME);
+
+        portENTER_CRITICAL(&frameLock);
+        self->flushingIndex = -1;
+        portEXIT_CRITICAL(&frameLock);
+    }
+}
+
+/**
+ * @brief Sends the tiles of a frame that differ from the last frame sent.
+ *
+ * The frame is compared with the last frame tile by tile (8x8 pixels, 8 bytes). On each tile row,
+ * every run of consecutive changed tiles is sent with a single transfer. The tiles are sent straight
+ * from the given frame with u8x8_DrawTile(), so the U8g2 buffer can be redrawn in the meantime.
+ *
+ * @param frame The frame to send, in the U8g2 buffer layout.
+ */
+void CustomDisplay::flushFrame(const uint8_t *frame)
+{
+    unsigned long start = micros();
+    uint32_t bytesBefore = bytesSent;
+    trace(TRACE_FRAME_BEGIN);
+
+    uint8_t tileWidth = getBufferTileWidth();
+    uint8_t tileHeight = getBufferTileHeight();
+    uint16_t rowSize = tileWidth * 8;
+    bool valid = lastFrameValid;
+
+    for (uint8_t tileY = 0; tileY < tileHeight; tileY++)
+    {
+        uint8_t tileX = 0;
+        while (tileX < tileWidth)
+        {
+            uint16_t offset = tileY * rowSize + tileX * 8;
+            if (valid && memcmp(frame + offset, lastFrame + offset, 8) == 0)
+            {
+                tileX++;
+                continue;
+            }
+
+            // Extend the run over the following changed tiles
+            uint8_t runStart = tileX;
+            do
+            {
+                tileX++;
+                offset += 8;
+            } while (tileX < tileWidth && !(valid && memcmp(frame + offset, lastFrame + offset, 8) == 0));
+
+            uint16_t runOffset = tileY * rowSize + runStart * 8;
+            uint16_t runSize = (tileX - runStart) * 8;
+            memcpy(lastFrame + runOffset, frame + runOffset, runSize);
+            u8x8_DrawTile(getU8x8(), runStart, tileY, tileX - runStart, lastFrame + runOffset);
+            bytesSent += runSize;
+            transfers++;
+        }
+    }
+
+    lastFrameValid = true;
+    frames++;
+    trace(TRACE_FRAME_END, 0, (uint16_t)(bytesSent - bytesBefore));
+    lastFrameUs = micros() - start;
+    totalFrameUs += lastFrameUs;
+}
+
+#endif // DISPLAY_PAGE_MODE
@@ -1,437 +0,0 @@
-/***************************************************************************************
- * MIT License
- *
- * Copyright (c) 2024 Dabatnot, Azway Retro
- *
- * Permission is hereby granted, free of charge, to any person obtaining a copy
- * of this software and associated documentation files (the "Software"), to deal
- * in the Software without restriction, including without limitation the rights
- * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
- * copies of the Software, and to permit persons to whom the Software is
- * furnished to do so, subject to the following conditions:
- *
- * The above copyright notice and this permission notice shall be included in all
- * copies or substantial portions of the Software.
- *
- * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
- * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
- * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
- * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
- * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
- * SOFTWARE.
- ****************************************************************************************/
-
-/**
- * @file images.cpp
- * @brief Source file containing bitmap definitions for the OLED display.
- *
- * This file includes various bitmap images stored in PROGMEM to be used with the OLED display.
- * Each bitmap has its width, height, and byte array defined.
- */
-
-#include "images.h"
-
-const uint8_t Azway_Logo[] PROGMEM = {
-	0x80, 0xff, 0xff, 0x01, 0x00, 0xe0, 0xff, 0x7f, 0x00, 0xf0, 0xff, 0x7f, 0xc0, 0xff, 0x80, 0xff,
-	0xff, 0x03, 0xf8, 0xff, 0x3f, 0x30, 0x80, 0x03, 0xff, 0xff, 0x07, 0xfc, 0xff, 0x1f, 0x08, 0x00,
-	0x04, 0xfe, 0xff, 0x0f, 0xfe, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0xc0, 0x1f, 0x3e, 0x00, 0x00,
-	0x02, 0x00, 0x10, 0x00, 0x00, 0x1f, 0x1e, 0x00, 0x00, 0x02, 0x00, 0x10, 0x00, 0x00, 0x1e, 0x1f,
-	0x3c, 0x00, 0x01, 0x00, 0x20, 0x00, 0x03, 0x3e, 0x0f, 0x3c, 0x00, 0x01, 0x00, 0x20, 0x80, 0x07,
-	0x3c, 0x0f, 0x3c, 0x80, 0x00, 0x00, 0x20, 0x80, 0x07, 0x3c, 0x0f, 0x18, 0x80, 0x00, 0x00, 0x40,
-	0x20, 0x13, 0x3c, 0x8f, 0xc3, 0x81, 0x00, 0x00, 0x40, 0x70, 0x38, 0x3c, 0x8f, 0xe7, 0x81, 0x00,
-	0x00, 0x40, 0xf8, 0x7c, 0x3c, 0x8f, 0xc3, 0x81, 0x00, 0x00, 0x40, 0x70, 0x38, 0x3c, 0x0f, 0x18,
-	0x80, 0x00, 0x00, 0x40, 0x20, 0x13, 0x3c, 0x0f, 0x3c, 0x80, 0x00, 0x00, 0x20, 0x80, 0x07, 0x3c,
-	0x0f, 0x3c, 0x00, 0x01, 0x00, 0x20, 0x80, 0x07, 0x3c, 0x1f, 0x3c, 0x00, 0x01, 0x00, 0x30, 0x00,
-	0x03, 0x3e, 0x1e, 0x00, 0x00, 0x02, 0x00, 0x10, 0x00, 0x00, 0x1e, 0x3e, 0x00, 0x00, 0x02, 0x00,
-	0x18, 0x00, 0x00, 0x1f, 0xfe, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0xc0, 0x1f, 0xfc, 0xff, 0x0f,
-	0x08, 0x00, 0x06, 0xfe, 0xff, 0x0f, 0xf8, 0xff, 0x1f, 0x70, 0x80, 0x03, 0xfe, 0xff, 0x07, 0xf0,
-	0xff, 0x3f, 0x80, 0x7f, 0x00, 0xff, 0xff, 0x03, 0x80, 0xff, 0xff, 0x00, 0x00, 0xc0, 0xff, 0x7f,
-	0x00};
-
-// 'player1_on', 25x25px
-const uint8_t player1_on[] PROGMEM = {
-	0x00, 0xfe, 0x00, 0x00, 0x80, 0xff, 0x03, 0x00, 0xe0, 0xff, 0x0f, 0x00, 0xf0, 0xff, 0x1f, 0x00,
-	0xf8, 0xff, 0x3f, 0x00, 0xfc, 0x83, 0x7f, 0x00, 0xfc, 0x01, 0x7f, 0x00, 0xfe, 0xc7, 0xff, 0x00,
-	0xfe, 0xc7, 0xff, 0x00, 0xff, 0xc7, 0xff, 0x01, 0xff, 0xc7, 0xff, 0x01, 0xff, 0xc7, 0xff, 0x01,
-	0xff, 0xc7, 0xff, 0x01, 0xff, 0xc7, 0xff, 0x01, 0xff, 0xc7, 0xff, 0x01, 0xff, 0xc7, 0xff, 0x01,
-	0xfe, 0xc7, 0xff, 0x00, 0xfe, 0xc7, 0xff, 0x00, 0xfc, 0x83, 0x7f, 0x00, 0xfc, 0x01, 0x7f, 0x00,
-	0xf8, 0xff, 0x3f, 0x00, 0xf0, 0xff, 0x1f, 0x00, 0xe0, 0xff, 0x0f, 0x00, 0x80, 0xff, 0x03, 0x00,
-	0x00, 0xfe, 0x00, 0x00};
-
-// 'player2_on', 25x25px
-const uint8_t player2_on[] PROGMEM = {
-	0x00, 0xfe, 0x00, 0x00, 0x80, 0xff, 0x03, 0x00, 0xe0, 0xff, 0x0f, 0x00, 0xf0, 0xff, 0x1f, 0x00,
-	0xf8, 0xff, 0x3f, 0x00, 0x7c, 0x30, 0x78, 0x00, 0x3c, 0x00, 0x70, 0x00, 0xfe, 0x78, 0xfc, 0x00,
-	0xfe, 0x78, 0xfc, 0x00, 0xff, 0x78, 0xfc, 0x01, 0xff, 0x78, 0xfc, 0x01, 0xff, 0x78, 0xfc, 0x01,
-	0xff, 0x78, 0xfc, 0x01, 0xff, 0x78, 0xfc, 0x01, 0xff, 0x78, 0xfc, 0x01, 0xff, 0x78, 0xfc, 0x01,
-	0xfe, 0x78, 0xfc, 0x00, 0xfe, 0x78, 0xfc, 0x00, 0x7c, 0x30, 0x78, 0x00, 0x3c, 0x00, 0x70, 0x00,
-	0xf8, 0xff, 0x3f, 0x00, 0xf0, 0xff, 0x1f, 0x00, 0xe0, 0xff, 0x0f, 0x00, 0x80, 0xff, 0x03, 0x00,
-	0x00, 0xfe, 0x00, 0x00};
-
-// 'player3_on', 25x25px
-const uint8_t player3_on[] PROGMEM = {
-	0x00, 0xfe, 0x00, 0x00, 0x80, 0xff, 0x03, 0x00, 0xe0, 0xff, 0x0f, 0x00, 0xf0, 0xff, 0x1f, 0x00,
-	0xf8, 0xff, 0x3f, 0x00, 0x04, 0x83, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xc7, 0xe3, 0x00,
-	0x8e, 0xc7, 0xe3, 0x00, 0x8f, 0xc7, 0xe3, 0x01, 0x8f, 0xc7, 0xe3, 0x01, 0x8f, 0xc7, 0xe3, 0x01,
-	0x8f, 0xc7, 0xe3, 0x01, 0x8f, 0xc7, 0xe3, 0x01, 0x8f, 0xc7, 0xe3, 0x01, 0x8f, 0xc7, 0xe3, 0x01,
-	0x8e, 0xc7, 0xe3, 0x00, 0x8e, 0xc7, 0xe3, 0x00, 0x04, 0x83, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xf8, 0xff, 0x3f, 0x00, 0xf0, 0xff, 0x1f, 0x00, 0xe0, 0xff, 0x0f, 0x00, 0x80, 0xff, 0x03, 0x00,
-	0x00, 0xfe, 0x00, 0x00};
-
-// 'player4_on', 25x25px
-const uint8_t player4_on[] PROGMEM = {
-	0x00, 0xfe, 0x00, 0x00, 0x80, 0xff, 0x03, 0x00, 0xe0, 0xff, 0x0f, 0x00, 0xf0, 0xff, 0x1f, 0x00,
-	0xf8, 0xff, 0x3f, 0x00, 0x0c, 0xf2, 0x4f, 0x00, 0x04, 0xe0, 0x47, 0x00, 0x1e, 0xe3, 0xc7, 0x00,
-	0x1e, 0xe7, 0xe7, 0x00, 0x1f, 0xc7, 0xe3, 0x01, 0x1f, 0xc7, 0xe3, 0x01, 0x1f, 0xcf, 0xf3, 0x01,
-	0x1f, 0x8f, 0xf1, 0x01, 0x1f, 0x8f, 0xf1, 0x01, 0x1f, 0x9f, 0xf9, 0x01, 0x1f, 0x9f, 0xf9, 0x01,
-	0x1e, 0x1f, 0xf8, 0x00, 0x1e, 0x3f, 0xfc, 0x00, 0x0c, 0x3e, 0x7c, 0x00, 0x04, 0x7c, 0x7e, 0x00,
-	0xf8, 0xff, 0x3f, 0x00, 0xf0, 0xff, 0x1f, 0x00, 0xe0, 0xff, 0x0f, 0x00, 0x80, 0xff, 0x03, 0x00,
-	0x00, 0xfe, 0x00, 0x00};
-
-// 'player1_off', 25x25px
-const uint8_t player1_off[] PROGMEM = {
-	0x00, 0xfe, 0x00, 0x00, 0x80, 0x00, 0x02, 0x00, 0x20, 0x00, 0x08, 0x00, 0x10, 0x00, 0x10, 0x00,
-	0x08, 0x00, 0x20, 0x00, 0x04, 0x7c, 0x40, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x02, 0x38, 0x80, 0x00,
-	0x00, 0x38, 0x00, 0x00, 0x01, 0x38, 0x00, 0x01, 0x01, 0x38, 0x00, 0x01, 0x01, 0x38, 0x00, 0x01,
-	0x01, 0x38, 0x00, 0x01, 0x01, 0x38, 0x00, 0x01, 0x01, 0x38, 0x00, 0x01, 0x01, 0x38, 0x00, 0x01,
-	0x00, 0x38, 0x00, 0x00, 0x02, 0x38, 0x80, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x04, 0xfe, 0x40, 0x00,
-	0x08, 0x00, 0x20, 0x00, 0x10, 0x00, 0x10, 0x00, 0x20, 0x00, 0x08, 0x00, 0x80, 0x00, 0x02, 0x00,
-	0x00, 0xfe, 0x00, 0x00};
-// 'player2_off', 25x25px
-const uint8_t player2_off[] PROGMEM = {
-	0x00, 0xfe, 0x00, 0x00, 0x80, 0x00, 0x02, 0x00, 0x20, 0x00, 0x08, 0x00, 0x10, 0x00, 0x10, 0x00,
-	0x08, 0x00, 0x20, 0x00, 0x84, 0xcf, 0x47, 0x00, 0xc0, 0xff, 0x0f, 0x00, 0x02, 0x87, 0x83, 0x00,
-	0x00, 0x87, 0x03, 0x00, 0x01, 0x87, 0x03, 0x01, 0x01, 0x87, 0x03, 0x01, 0x01, 0x87, 0x03, 0x01,
-	0x01, 0x87, 0x03, 0x01, 0x01, 0x87, 0x03, 0x01, 0x01, 0x87, 0x03, 0x01, 0x01, 0x87, 0x03, 0x01,
-	0x00, 0x87, 0x03, 0x00, 0x02, 0x87, 0x83, 0x00, 0x80, 0xcf, 0x07, 0x00, 0xc4, 0xff, 0x4f, 0x00,
-	0x08, 0x00, 0x20, 0x00, 0x10, 0x00, 0x10, 0x00, 0x20, 0x00, 0x08, 0x00, 0x80, 0x00, 0x02, 0x00,
-	0x00, 0xfe, 0x00, 0x00};
-// 'player3_off', 25x25px
-const uint8_t player3_off[] PROGMEM = {
-	0x00, 0xfe, 0x00, 0x00, 0x80, 0x00, 0x02, 0x00, 0x20, 0x00, 0x08, 0x00, 0x10, 0x00, 0x10, 0x00,
-	0x08, 0x00, 0x20, 0x00, 0xfc, 0x7c, 0x7e, 0x00, 0xfc, 0xff, 0x7f, 0x00, 0x72, 0x38, 0x9c, 0x00,
-	0x70, 0x38, 0x1c, 0x00, 0x71, 0x38, 0x1c, 0x01, 0x71, 0x38, 0x1c, 0x01, 0x71, 0x38, 0x1c, 0x01,
-	0x71, 0x38, 0x1c, 0x01, 0x71, 0x38, 0x1c, 0x01, 0x71, 0x38, 0x1c, 0x01, 0x71, 0x38, 0x1c, 0x01,
-	0x70, 0x38, 0x1c, 0x00, 0x72, 0x38, 0x9c, 0x00, 0xf8, 0x7c, 0x3e, 0x00, 0xfc, 0xff, 0x7f, 0x00,
-	0x08, 0x00, 0x20, 0x00, 0x10, 0x00, 0x10, 0x00, 0x20, 0x00, 0x08, 0x00, 0x80, 0x00, 0x02, 0x00,
-	0x00, 0xfe, 0x00, 0x00};
-// 'player4_off', 25x25px
-const uint8_t player4_off[] PROGMEM = {
-	0x00, 0xfe, 0x00, 0x00, 0x80, 0x00, 0x02, 0x00, 0x20, 0x00, 0x08, 0x00, 0x10, 0x00, 0x10, 0x00,
-	0x08, 0x00, 0x20, 0x00, 0xf4, 0x0d, 0x70, 0x00, 0xf8, 0x1f, 0x38, 0x00, 0xe2, 0x1c, 0xb8, 0x00,
-	0xe0, 0x18, 0x18, 0x00, 0xe1, 0x38, 0x1c, 0x01, 0xe1, 0x38, 0x1c, 0x01, 0xe1, 0x30, 0x0c, 0x01,
-	0xe1, 0x70, 0x0e, 0x01, 0xe1, 0x70, 0x0e, 0x01, 0xe1, 0x60, 0x06, 0x01, 0xe1, 0x60, 0x06, 0x01,
-	0xe0, 0xe0, 0x07, 0x00, 0xe2, 0xc0, 0x83, 0x00, 0xf0, 0xc1, 0x03, 0x00, 0xfc, 0x83, 0x41, 0x00,
-	0x08, 0x00, 0x20, 0x00, 0x10, 0x00, 0x10, 0x00, 0x20, 0x00, 0x08, 0x00, 0x80, 0x00, 0x02, 0x00,
-	0x00, 0xfe, 0x00, 0x00};
-
-const int player_off_LEN = 4;
-const uint8_t *player_off[4] = {
-	player1_off,
-	player2_off,
-	player3_off,
-	player4_off};
-
-const int player_on_LEN = 4;
-const uint8_t *player_on[4] = {
-	player1_on,
-	player2_on,
-	player3_on,
-	player4_on};
-
-// 'J1On', 32x32px
-const uint8_t JoyONJ1On[] PROGMEM = {
-	0xfc, 0xff, 0xff, 0x3f, 0x02, 0x00, 0x00, 0x40, 0xf1, 0xff, 0xff, 0x8f, 0xf9, 0xff, 0xff, 0x9f,
-	0xfd, 0xff, 0xff, 0xbf, 0x7d, 0xfc, 0xff, 0xbf, 0xbd, 0xf9, 0xff, 0xbf, 0xdd, 0xf0, 0xff, 0xbf,
-	0x5d, 0xf0, 0xff, 0xbf, 0x1d, 0x70, 0xce, 0xb9, 0x3d, 0x38, 0x84, 0xb0, 0x7d, 0x3c, 0x84, 0xb0,
-	0x7d, 0x7d, 0xce, 0xb9, 0x7d, 0xfd, 0xff, 0xbf, 0x7d, 0xfd, 0xff, 0xbf, 0x7d, 0x7d, 0xce, 0xb9,
-	0x7d, 0x3d, 0x84, 0xb0, 0x0d, 0x21, 0x84, 0xb0, 0x1d, 0x70, 0xce, 0xb9, 0xfd, 0xff, 0xff, 0xbf,
-	0xfd, 0xff, 0xff, 0xbf, 0xfd, 0x7f, 0xfe, 0xbf, 0xfd, 0x3f, 0xfe, 0xbf, 0xfd, 0x7f, 0xfe, 0xbf,
-	0xfd, 0x7f, 0xfe, 0xbf, 0xfd, 0x7f, 0xfe, 0xbf, 0xfd, 0x7f, 0xfe, 0xbf, 0xfd, 0x7f, 0xfe, 0xbf,
-	0xf9, 0xff, 0xff, 0x9f, 0xf1, 0xff, 0xff, 0x8f, 0x02, 0x00, 0x00, 0x40, 0xfc, 0xff, 0xff, 0x3f};
-// 'J2On', 32x32px
-const uint8_t JoyONJ2On[] PROGMEM = {
-	0xfc, 0xff, 0xff, 0x3f, 0x02, 0x00, 0x00, 0x40, 0xf1, 0xff, 0xff, 0x8f, 0xf9, 0xff, 0xff, 0x9f,
-	0xfd, 0xff, 0xff, 0xbf, 0x7d, 0xfc, 0xff, 0xbf, 0xbd, 0xf9, 0xff, 0xbf, 0xdd, 0xf0, 0xff, 0xbf,
-	0x5d, 0xf0, 0xff, 0xbf, 0x1d, 0x70, 0xce, 0xb9, 0x3d, 0x38, 0x84, 0xb0, 0x7d, 0x3c, 0x84, 0xb0,
-	0x7d, 0x7d, 0xce, 0xb9, 0x7d, 0xfd, 0xff, 0xbf, 0x7d, 0xfd, 0xff, 0xbf, 0x7d, 0x7d, 0xce, 0xb9,
-	0x7d, 0x3d, 0x84, 0xb0, 0x0d, 0x21, 0x84, 0xb0, 0x1d, 0x70, 0xce, 0xb9, 0xfd, 0xff, 0xff, 0xbf,
-	0xfd, 0xff, 0xff, 0xbf, 0xfd, 0x7f, 0xfe, 0xbf, 0xfd, 0xbf, 0xfd, 0xbf, 0xfd, 0xff, 0xfd, 0xbf,
-	0xfd, 0xff, 0xfe, 0xbf, 0xfd, 0x7f, 0xff, 0xbf, 0xfd, 0xbf, 0xff, 0xbf, 0xfd, 0x3f, 0xfc, 0xbf,
-	0xf9, 0xff, 0xff, 0x9f, 0xf1, 0xff, 0xff, 0x8f, 0x02, 0x00, 0x00, 0x40, 0xfc, 0xff, 0xff, 0x3f};
-// 'J3On', 32x32px
-const uint8_t JoyONJ3On[] PROGMEM = {
-	0xfc, 0xff, 0xff, 0x3f, 0x02, 0x00, 0x00, 0x40, 0xf1, 0xff, 0xff, 0x8f, 0xf9, 0xff, 0xff, 0x9f,
-	0xfd, 0xff, 0xff, 0xbf, 0x7d, 0xfc, 0xff, 0xbf, 0xbd, 0xf9, 0xff, 0xbf, 0xdd, 0xf0, 0xff, 0xbf,
-	0x5d, 0xf0, 0xff, 0xbf, 0x1d, 0x70, 0xce, 0xb9, 0x3d, 0x38, 0x84, 0xb0, 0x7d, 0x3c, 0x84, 0xb0,
-	0x7d, 0x7d, 0xce, 0xb9, 0x7d, 0xfd, 0xff, 0xbf, 0x7d, 0xfd, 0xff, 0xbf, 0x7d, 0x7d, 0xce, 0xb9,
-	0x7d, 0x3d, 0x84, 0xb0, 0x0d, 0x21, 0x84, 0xb0, 0x1d, 0x70, 0xce, 0xb9, 0xfd, 0xff, 0xff, 0xbf,
-	0xfd, 0xff, 0xff, 0xbf, 0xfd, 0x7f, 0xfe, 0xbf, 0xfd, 0xbf, 0xfd, 0xbf, 0xfd, 0xff, 0xfd, 0xbf,
-	0xfd, 0xff, 0xfe, 0xbf, 0xfd, 0xff, 0xfd, 0xbf, 0xfd, 0xbf, 0xfd, 0xbf, 0xfd, 0x7f, 0xfe, 0xbf,
-	0xf9, 0xff, 0xff, 0x9f, 0xf1, 0xff, 0xff, 0x8f, 0x02, 0x00, 0x00, 0x40, 0xfc, 0xff, 0xff, 0x3f};
-// 'J4On', 32x32px
-const uint8_t JoyONJ4On[] PROGMEM = {
-	0xfc, 0xff, 0xff, 0x3f, 0x02, 0x00, 0x00, 0x40, 0xf1, 0xff, 0xff, 0x8f, 0xf9, 0xff, 0xff, 0x9f,
-	0xfd, 0xff, 0xff, 0xbf, 0x7d, 0xfc, 0xff, 0xbf, 0xbd, 0xf9, 0xff, 0xbf, 0xdd, 0xf0, 0xff, 0xbf,
-	0x5d, 0xf0, 0xff, 0xbf, 0x1d, 0x70, 0xce, 0xb9, 0x3d, 0x38, 0x84, 0xb0, 0x7d, 0x3c, 0x84, 0xb0,
-	0x7d, 0x7d, 0xce, 0xb9, 0x7d, 0xfd, 0xff, 0xbf, 0x7d, 0xfd, 0xff, 0xbf, 0x7d, 0x7d, 0xce, 0xb9,
-	0x7d, 0x3d, 0x84, 0xb0, 0x0d, 0x21, 0x84, 0xb0, 0x1d, 0x70, 0xce, 0xb9, 0xfd, 0xff, 0xff, 0xbf,
-	0xfd, 0xff, 0xff, 0xbf, 0xfd, 0x7f, 0xfe, 0xbf, 0xfd, 0x3f, 0xfe, 0xbf, 0xfd, 0x5f, 0xfe, 0xbf,
-	0xfd, 0x5f, 0xfe, 0xbf, 0xfd, 0x1f, 0xfc, 0xbf, 0xfd, 0x7f, 0xfe, 0xbf, 0xfd, 0x7f, 0xfe, 0xbf,
-	0xf9, 0xff, 0xff, 0x9f, 0xf1, 0xff, 0xff, 0x8f, 0x02, 0x00, 0x00, 0x40, 0xfc, 0xff, 0xff, 0x3f};
-
-// Array of all bitmaps for convenience. (Total bytes used to store images in PROGMEM = 576)
-const int JoyON_LEN = 4;
-const uint8_t *JoyON[4] = {
-	JoyONJ1On,
-	JoyONJ2On,
-	JoyONJ3On,
-	JoyONJ4On};
-
-const uint8_t JoyOFFJ1Off[] PROGMEM = {
-	0xfc, 0xff, 0xff, 0x3f, 0x02, 0x00, 0x00, 0x40, 0xf1, 0xff, 0xff, 0x8f, 0x09, 0x00, 0x00, 0x90,
-	0x05, 0x00, 0x00, 0xa0, 0x85, 0x03, 0x00, 0xa0, 0x45, 0x06, 0x00, 0xa0, 0x25, 0x0f, 0x00, 0xa0,
-	0xa5, 0x0f, 0x00, 0xa0, 0xe5, 0x8f, 0x31, 0xa6, 0xc5, 0xc7, 0x7b, 0xaf, 0x85, 0xc3, 0x7b, 0xaf,
-	0x85, 0x82, 0x31, 0xa6, 0x85, 0x02, 0x00, 0xa0, 0x85, 0x02, 0x00, 0xa0, 0x85, 0x82, 0x31, 0xa6,
-	0x85, 0xc2, 0x7b, 0xaf, 0xf5, 0xde, 0x7b, 0xaf, 0xe5, 0x8f, 0x31, 0xa6, 0x05, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0xa0, 0x05, 0x80, 0x01, 0xa0, 0x05, 0xc0, 0x01, 0xa0, 0x05, 0x80, 0x01, 0xa0,
-	0x05, 0x80, 0x01, 0xa0, 0x05, 0x80, 0x01, 0xa0, 0x05, 0x80, 0x01, 0xa0, 0x05, 0x80, 0x01, 0xa0,
-	0x09, 0x00, 0x00, 0x90, 0xf1, 0xff, 0xff, 0x8f, 0x02, 0x00, 0x00, 0x40, 0xfc, 0xff, 0xff, 0x3f};
-// 'J2Off', 32x32px
-const uint8_t JoyOFFJ2Off[] PROGMEM = {
-	0xfc, 0xff, 0xff, 0x3f, 0x02, 0x00, 0x00, 0x40, 0xf1, 0xff, 0xff, 0x8f, 0x09, 0x00, 0x00, 0x90,
-	0x05, 0x00, 0x00, 0xa0, 0x85, 0x03, 0x00, 0xa0, 0x45, 0x06, 0x00, 0xa0, 0x25, 0x0f, 0x00, 0xa0,
-	0xa5, 0x0f, 0x00, 0xa0, 0xe5, 0x8f, 0x31, 0xa6, 0xc5, 0xc7, 0x7b, 0xaf, 0x85, 0xc3, 0x7b, 0xaf,
-	0x85, 0x82, 0x31, 0xa6, 0x85, 0x02, 0x00, 0xa0, 0x85, 0x02, 0x00, 0xa0, 0x85, 0x82, 0x31, 0xa6,
-	0x85, 0xc2, 0x7b, 0xaf, 0xf5, 0xde, 0x7b, 0xaf, 0xe5, 0x8f, 0x31, 0xa6, 0x05, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0xa0, 0x05, 0x80, 0x01, 0xa0, 0x05, 0x40, 0x02, 0xa0, 0x05, 0x00, 0x02, 0xa0,
-	0x05, 0x00, 0x01, 0xa0, 0x05, 0x80, 0x00, 0xa0, 0x05, 0x40, 0x00, 0xa0, 0x05, 0xc0, 0x03, 0xa0,
-	0x09, 0x00, 0x00, 0x90, 0xf1, 0xff, 0xff, 0x8f, 0x02, 0x00, 0x00, 0x40, 0xfc, 0xff, 0xff, 0x3f};
-// 'J3Off', 32x32px
-const uint8_t JoyOFFJ3Off[] PROGMEM = {
-	0xfc, 0xff, 0xff, 0x3f, 0x02, 0x00, 0x00, 0x40, 0xf1, 0xff, 0xff, 0x8f, 0x09, 0x00, 0x00, 0x90,
-	0x05, 0x00, 0x00, 0xa0, 0x85, 0x03, 0x00, 0xa0, 0x45, 0x06, 0x00, 0xa0, 0x25, 0x0f, 0x00, 0xa0,
-	0xa5, 0x0f, 0x00, 0xa0, 0xe5, 0x8f, 0x31, 0xa6, 0xc5, 0xc7, 0x7b, 0xaf, 0x85, 0xc3, 0x7b, 0xaf,
-	0x85, 0x82, 0x31, 0xa6, 0x85, 0x02, 0x00, 0xa0, 0x85, 0x02, 0x00, 0xa0, 0x85, 0x82, 0x31, 0xa6,
-	0x85, 0xc2, 0x7b, 0xaf, 0xf5, 0xde, 0x7b, 0xaf, 0xe5, 0x8f, 0x31, 0xa6, 0x05, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0xa0, 0x05, 0x80, 0x01, 0xa0, 0x05, 0x40, 0x02, 0xa0, 0x05, 0x00, 0x02, 0xa0,
-	0x05, 0x00, 0x01, 0xa0, 0x05, 0x00, 0x02, 0xa0, 0x05, 0x40, 0x02, 0xa0, 0x05, 0x80, 0x01, 0xa0,
-	0x09, 0x00, 0x00, 0x90, 0xf1, 0xff, 0xff, 0x8f, 0x02, 0x00, 0x00, 0x40, 0xfc, 0xff, 0xff, 0x3f};
-// 'J4Off', 32x32px
-const uint8_t JoyOFFJ4Off[] PROGMEM = {
-	0xfc, 0xff, 0xff, 0x3f, 0x02, 0x00, 0x00, 0x40, 0xf1, 0xff, 0xff, 0x8f, 0x09, 0x00, 0x00, 0x90,
-	0x05, 0x00, 0x00, 0xa0, 0x85, 0x03, 0x00, 0xa0, 0x45, 0x06, 0x00, 0xa0, 0x25, 0x0f, 0x00, 0xa0,
-	0xa5, 0x0f, 0x00, 0xa0, 0xe5, 0x8f, 0x31, 0xa6, 0xc5, 0xc7, 0x7b, 0xaf, 0x85, 0xc3, 0x7b, 0xaf,
-	0x85, 0x82, 0x31, 0xa6, 0x85, 0x02, 0x00, 0xa0, 0x85, 0x02, 0x00, 0xa0, 0x85, 0x82, 0x31, 0xa6,
-	0x85, 0xc2, 0x7b, 0xaf, 0xf5, 0xde, 0x7b, 0xaf, 0xe5, 0x8f, 0x31, 0xa6, 0x05, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0xa0, 0x05, 0x80, 0x01, 0xa0, 0x05, 0xc0, 0x01, 0xa0, 0x05, 0xa0, 0x01, 0xa0,
-	0x05, 0xa0, 0x01, 0xa0, 0x05, 0xe0, 0x03, 0xa0, 0x05, 0x80, 0x01, 0xa0, 0x05, 0x80, 0x01, 0xa0,
-	0x09, 0x00, 0x00, 0x90, 0xf1, 0xff, 0xff, 0x8f, 0x02, 0x00, 0x00, 0x40, 0xfc, 0xff, 0xff, 0x3f};
-
-// Array of all bitmaps for convenience. (Total bytes used to store images in PROGMEM = 576)
-const int JoyOFF_LEN = 4;
-const uint8_t *JoyOFF[4] = {
-	JoyOFFJ1Off,
-	JoyOFFJ2Off,
-	JoyOFFJ3Off,
-	JoyOFFJ4Off};
-
-// 'BottomFrame', 128x32px
-const uint8_t FrameTopFrame[] PROGMEM = {
-	0xfc, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0x3f,
-	0x02, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x40,
-	0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
-	0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
-	0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
-	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-	0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f};
-// 'TopFrame', 128x32px
-const uint8_t FrameBottomFrame[] PROGMEM = {
-	0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f,
-	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-	0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
-	0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-	0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
-	0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
-	0x02, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x40,
-	0xfc, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0x3f};
-
-// Array of all bitmaps for convenience. (Total bytes used to store images in PROGMEM = 1056)
-const int BmpFrame_LEN = 2;
-const uint8_t *BmpFrame[2] = {
-	FrameBottomFrame,
-	FrameTopFrame};
-
-// 'Status', 63x10px
-const uint8_t bmpStatus[] PROGMEM = {
-	0xfe, 0xf8, 0xc7, 0x0f, 0xff, 0xbc, 0xc7, 0x1f, 0x83, 0x09, 0x6c, 0x30, 0x81, 0xe5, 0x6c, 0x30,
-	0x39, 0x3b, 0x2f, 0x67, 0xe7, 0xe5, 0x2c, 0x67, 0xf9, 0x23, 0x2f, 0x67, 0xe4, 0xe5, 0x2c, 0x7f,
-	0x83, 0x23, 0x23, 0x67, 0x64, 0xe4, 0x6c, 0x70, 0x3f, 0x23, 0x23, 0x60, 0x64, 0xe4, 0xec, 0x67,
-	0x39, 0x23, 0x23, 0x67, 0x64, 0xe4, 0x2c, 0x67, 0x83, 0x23, 0x23, 0x67, 0x64, 0x0c, 0x6e, 0x70,
-	0xfe, 0xe3, 0xe3, 0x7f, 0x7c, 0xf8, 0xcf, 0x7f, 0xfc, 0xc0, 0xc3, 0x7b, 0x78, 0xf0, 0x87, 0x1f};
-
-// 'StarBlack', 16x15px
-const uint8_t FrameStarBlack[] PROGMEM = {
-	0x80, 0x01, 0x40, 0x02, 0x40, 0x02, 0x20, 0x04, 0x3f, 0xfc, 0x01, 0x80, 0x42, 0x42, 0x44, 0x22,
-	0x48, 0x12, 0x08, 0x10, 0x04, 0x20, 0x84, 0x21, 0x62, 0x46, 0x12, 0x48, 0x0e, 0x70};
-// 'StarWhite', 16x15px
-const uint8_t FrameStarWhite[] PROGMEM = {
-	0x80, 0x01, 0xc0, 0x03, 0xc0, 0x03, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x7d, 0xbc, 0x3d,
-	0xb8, 0x1d, 0xf8, 0x1f, 0xfc, 0x3f, 0xfc, 0x3f, 0x7e, 0x7e, 0x1e, 0x78, 0x0e, 0x70};
-
-// Array of all bitmaps for convenience. (Total bytes used to store images in PROGMEM = 96)
-const int bmpStar_LEN = 2;
-const uint8_t *bmpStar[2] = {
-	FrameStarBlack,
-	FrameStarWhite};
-
-// 'Connected', 120x22px
-const uint8_t ConnectionStateConnected[] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x48, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xcf, 0x4f, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x80, 0x00, 0x48, 0xc8, 0x03, 0x80, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x40, 0x00, 0x48, 0x48, 0x04, 0x80, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x20, 0x00, 0x48, 0x48, 0x08, 0x80, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-	0x00, 0x48, 0x48, 0x08, 0x80, 0xa2, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x00, 0x3e, 0x00,
-	0x48, 0x48, 0xf8, 0x80, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc0, 0x21, 0x00, 0x48,
-	0x48, 0x08, 0x87, 0xa2, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x04, 0x3c, 0x21, 0x00, 0x48, 0x48,
-	0x08, 0x79, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x22, 0x21, 0x00, 0x48, 0x48, 0x08,
-	0x09, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x21, 0x21, 0x00, 0x48, 0x48, 0x08, 0x89,
-	0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x3c, 0x21, 0x00, 0x48, 0x48, 0x08, 0x79, 0x40,
-	0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x8a, 0xc2, 0x21, 0x00, 0x48, 0x48, 0x08, 0x07, 0x80, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x02, 0x3e, 0x00, 0x48, 0x48, 0xf8, 0x00, 0x00, 0xff, 0xff,
-	0xff, 0x00, 0x00, 0x00, 0x8a, 0x02, 0x20, 0x00, 0x48, 0x48, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x8a, 0x02, 0x20, 0x00, 0x48, 0x48, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x8a, 0x02, 0x40, 0x00, 0x48, 0x48, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x72, 0x02, 0x80, 0x00, 0x48, 0xc8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x04, 0x01, 0x00, 0xff, 0xcf, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-	0x00, 0x00, 0x00, 0x48, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-// 'Connecting', 120x22px
-const uint8_t ConnectionStateConnecting[] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x00, 0x12, 0x00, 0x80, 0x0f, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xf8, 0x7f, 0x02, 0x00, 0x80, 0xff, 0x13, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x04, 0x40, 0x02, 0x00, 0x80, 0x00, 0xf2, 0x00, 0x20, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x02, 0x40, 0x02, 0x00, 0x80, 0x00, 0x12, 0x01, 0xa0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-	0x40, 0x02, 0x00, 0xff, 0x00, 0x12, 0x02, 0xa0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-	0x02, 0x80, 0xc0, 0x00, 0x12, 0x02, 0xa0, 0x28, 0x00, 0xff, 0x0f, 0x00, 0xf0, 0x01, 0x40, 0x02,
-	0x00, 0xff, 0x00, 0x12, 0x3e, 0xa0, 0x28, 0x00, 0x00, 0x10, 0x00, 0x0e, 0x01, 0x40, 0x02, 0x00,
-	0x80, 0x00, 0x12, 0xc2, 0xa1, 0x28, 0x00, 0xff, 0x27, 0xe0, 0x09, 0x01, 0x40, 0x02, 0x00, 0x80,
-	0x1f, 0x12, 0x42, 0x9e, 0x28, 0x00, 0x00, 0x48, 0x10, 0x09, 0x01, 0x40, 0x02, 0x00, 0x80, 0x10,
-	0x12, 0x42, 0x42, 0x28, 0x00, 0x00, 0x50, 0x08, 0x09, 0x01, 0x40, 0x02, 0x00, 0x80, 0x10, 0x12,
-	0x42, 0x22, 0x48, 0x00, 0x00, 0x50, 0xe4, 0x09, 0x01, 0x40, 0x02, 0x00, 0x80, 0x1f, 0x12, 0x42,
-	0x1e, 0x90, 0xff, 0x00, 0x50, 0x14, 0x0e, 0x01, 0x40, 0x02, 0x00, 0x80, 0x00, 0x12, 0xc2, 0x01,
-	0x20, 0x00, 0x00, 0x50, 0x14, 0xf0, 0x01, 0x40, 0x02, 0x00, 0xff, 0x00, 0x12, 0x3e, 0x00, 0xc0,
-	0xff, 0x00, 0x50, 0x14, 0x00, 0x01, 0x40, 0x02, 0x80, 0x80, 0x00, 0x12, 0x02, 0x00, 0x00, 0x00,
-	0x00, 0x50, 0x14, 0x00, 0x01, 0x40, 0x02, 0x00, 0xff, 0x00, 0x12, 0x02, 0x00, 0x00, 0x00, 0x00,
-	0x50, 0x14, 0x00, 0x02, 0x40, 0x02, 0x00, 0x80, 0x00, 0x12, 0x01, 0x00, 0x00, 0x00, 0x00, 0x90,
-	0x13, 0x00, 0x04, 0x40, 0x02, 0x00, 0x80, 0x00, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08,
-	0x00, 0xf8, 0x7f, 0x02, 0x00, 0x80, 0xff, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x07, 0x00,
-	0x00, 0x40, 0x02, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x80, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00};
-
-// Array of all bitmaps for convenience. (Total bytes used to store images in PROGMEM = 704)
-const int ConnectionStateallArray_LEN = 2;
-const uint8_t *ConnectionStateallArray[2] = {
-	ConnectionStateConnected,
-	ConnectionStateConnecting};
-
-// 'Rocket', 14x19px
-const uint8_t bmpRocket[] PROGMEM = {
-	0xc0, 0x00, 0x20, 0x01, 0x10, 0x02, 0x10, 0x02, 0xf0, 0x03, 0x10, 0x02, 0xd8, 0x06, 0xd4, 0x0a,
-	0xd2, 0x12, 0x11, 0x22, 0xfd, 0x2f, 0x13, 0x32, 0x11, 0x22, 0x01, 0x20, 0xe0, 0x01, 0x10, 0x02,
-	0x10, 0x02, 0x20, 0x01, 0xc0, 0x00};
-
-// 'Starting', 80x10px
-const uint8_t bmpStarting[] PROGMEM = {
-	0xfe, 0xf8, 0xc7, 0x0f, 0x7f, 0xf8, 0xe7, 0x79, 0x8f, 0x1f, 0x83, 0x09, 0x6c, 0x30, 0x81, 0x08,
-	0x2c, 0xcb, 0xd9, 0x20, 0x39, 0x3b, 0x2f, 0x67, 0x39, 0x3b, 0x2f, 0x8b, 0x59, 0xce, 0xf9, 0x23,
-	0x2f, 0x67, 0x39, 0x23, 0x2f, 0x0b, 0x59, 0xfe, 0x83, 0x23, 0x23, 0x67, 0x81, 0x23, 0x23, 0x4b,
-	0x58, 0xc6, 0x3f, 0x23, 0x23, 0x60, 0x39, 0x23, 0x23, 0xcb, 0x58, 0xce, 0x39, 0x23, 0x23, 0x67,
-	0x39, 0x23, 0x23, 0xcb, 0x59, 0xce, 0x83, 0x23, 0x23, 0x67, 0x39, 0x23, 0x23, 0xcb, 0xd9, 0xd0,
-	0xfe, 0xe3, 0xe3, 0x7f, 0xff, 0xe3, 0xe3, 0xfb, 0x9f, 0xff, 0xfc, 0xc0, 0xc3, 0x7b, 0xde, 0xc3,
-	0xc3, 0xf3, 0x1e, 0xff};
-
-// 'zzz', 17x15px
-const uint8_t bmpZZZ[] PROGMEM = {
-	0xe0, 0x1f, 0x00, 0x18, 0x60, 0x00, 0x04, 0x80, 0x00, 0x02, 0x38, 0x01, 0x82, 0x23, 0x01, 0x39,
-	0x12, 0x01, 0x21, 0x09, 0x01, 0x91, 0x38, 0x01, 0x89, 0x03, 0x01, 0x39, 0x00, 0x01, 0x01, 0x80,
-	0x00, 0x02, 0x60, 0x00, 0xf2, 0x1f, 0x00, 0x0a, 0x00, 0x00, 0x06, 0x00, 0x00};
-
-// 'Stopping', 80x10px
-const uint8_t bmpStopping[] PROGMEM = {
-	0xfe, 0xf8, 0xc7, 0x8f, 0x7f, 0xfc, 0xe3, 0x79, 0x8f, 0x1f, 0x83, 0x09, 0x6c, 0x98, 0xc0, 0x04,
-	0x26, 0xcb, 0xd9, 0x20, 0x39, 0x3b, 0x2f, 0xb3, 0x9c, 0xe5, 0x2c, 0x8b, 0x59, 0xce, 0xf9, 0x23,
-	0x2f, 0xb3, 0x9c, 0xe5, 0x2c, 0x0b, 0x59, 0xfe, 0x83, 0x23, 0x23, 0xb3, 0x9c, 0xe5, 0x2c, 0x4b,
-	0x58, 0xc6, 0x3f, 0x23, 0x23, 0xb3, 0xc0, 0x05, 0x2e, 0xcb, 0x58, 0xce, 0x39, 0x23, 0x23, 0xb3,
-	0xfc, 0xe5, 0x2f, 0xcb, 0x59, 0xce, 0x83, 0x23, 0x63, 0xb8, 0xfc, 0xe4, 0x27, 0xcb, 0xd9, 0xd0,
-	0xfe, 0xe3, 0xe3, 0xbf, 0x0f, 0x7c, 0xe0, 0xfb, 0x9f, 0xff, 0xfc, 0xc0, 0xc3, 0x3f, 0x0f, 0x78,
-	0xc0, 0xf3, 0x1e, 0xff};
-
-// 'Stopped', 74x10px
-const uint8_t bmpStopped[] PROGMEM = {
-	0xfe, 0xf8, 0xc7, 0x8f, 0x7f, 0xfc, 0xe3, 0x3f, 0x7f, 0x00, 0x83, 0x09, 0x6c, 0x98, 0xc0, 0x04,
-	0x26, 0x60, 0xc1, 0x00, 0x39, 0x3b, 0x2f, 0xb3, 0x9c, 0xe5, 0x2c, 0x7f, 0x99, 0x01, 0xf9, 0x23,
-	0x2f, 0xb3, 0x9c, 0xe5, 0x2c, 0x7f, 0x39, 0x03, 0x83, 0x23, 0x23, 0xb3, 0x9c, 0xe5, 0x2c, 0x30,
-	0x39, 0x03, 0x3f, 0x23, 0x23, 0xb3, 0xc0, 0x05, 0x2e, 0x3f, 0x39, 0x03, 0x39, 0x23, 0x23, 0xb3,
-	0xfc, 0xe5, 0x2f, 0x3f, 0x99, 0x03, 0x83, 0x23, 0x63, 0xb8, 0xfc, 0xe4, 0x27, 0x60, 0xc1, 0x03,
-	0xfe, 0xe3, 0xe3, 0xbf, 0x0f, 0x7c, 0xe0, 0x7f, 0xff, 0x01, 0xfc, 0xc0, 0xc3, 0x3f, 0x0f, 0x78,
-	0xc0, 0x7f, 0xfe, 0x00};
-
-// 'Bye', 20x14px
-const uint8_t bmpBye[] PROGMEM = {
-	0xfc, 0xff, 0x03, 0x02, 0x00, 0x04, 0x01, 0x00, 0x08, 0x39, 0xe9, 0x09, 0x49, 0x29, 0x08, 0x39,
-	0xee, 0x08, 0x49, 0x28, 0x08, 0x79, 0xe6, 0x09, 0x01, 0x00, 0x08, 0x02, 0x00, 0x04, 0xfc, 0x9f,
-	0x03, 0x00, 0x50, 0x00, 0x00, 0x30, 0x00, 0x00, 0x10, 0x00};
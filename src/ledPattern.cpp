@@ -0,0 +1,333 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file ledPattern.cpp
+ * @brief Source file for the LED pattern engine.
+ *
+ * This file contains the pattern evaluation and trace functions, and the RMT, LEDC and mock backends.
+ */
+
+#include "ledPattern.h"
+#if defined(ARDUINO_ARCH_ESP32) && defined(LED_PATTERN_LEDC)
+#include <driver/ledc.h>
+#endif
+
+/**
+ * @brief Gives the level of the segment played before a given one, the pattern being looped.
+ *
+ * @param pattern The pattern.
+ * @param index Index of the segment.
+ */
+static uint8_t previousLevel(const LedPattern &pattern, uint8_t index)
+{
+    return pattern.segments[(index + pattern.count - 1) % pattern.count].level;
+}
+
+/**
+ * @brief Gives the LED level of a pattern at a given time.
+ *
+ * A fade is seen as a switch to its level at the middle of its segment, as backends without PWM play it.
+ *
+ * @param pattern The pattern.
+ * @param elapsedMs Time since the pattern was started, in milliseconds.
+ * @return The LED level, HIGH or LOW.
+ */
+uint8_t ledPatternLevel(const LedPattern &pattern, uint32_t elapsedMs)
+{
+    if (pattern.count == 1)
+    {
+        return pattern.segments[0].level;
+    }
+
+    uint32_t period = 0;
+    for (uint8_t i = 0; i < pattern.count; i++)
+    {
+        period += pattern.segments[i].durationMs;
+    }
+
+    uint32_t t = elapsedMs % period;
+    for (uint8_t i = 0; i < pattern.count; i++)
+    {
+        if (t < pattern.segments[i].durationMs)
+        {
+            bool fading = pattern.segments[i].fade && t < pattern.segments[i].durationMs / 2;
+            return fading ? previousLevel(pattern, i) : pattern.segments[i].level;
+        }
+        t -= pattern.segments[i].durationMs;
+    }
+    return pattern.segments[pattern.count - 1].level;
+}
+
+/**
+ * @brief Prints the level changes of a pattern over a time window.
+ *
+ * Consecutive segments with the same level are merged, so the trace only shows real edges. A fade
+ * is shown at its start with a '~' instead of the '='.
+ *
+ * @param name Name printed before the trace.
+ * @param pattern The pattern.
+ * @param windowMs Length of the time window in milliseconds.
+ * @param out Where to print the trace.
+ */
+void printLedPatternTrace(const char *name, const LedPattern &pattern, uint32_t windowMs, Print &out)
+{
+    out.print(name);
+    out.print(":0=");
+    uint8_t level = pattern.segments[0].fade ? previousLevel(pattern, 0) : pattern.segments[0].level;
+    out.print(level);
+
+    if (pattern.count > 1)
+    {
+        uint32_t t = 0;
+        uint8_t i = 0;
+        while (t < windowMs)
+        {
+            if (pattern.segments[i].level != level)
+            {
+                level = pattern.segments[i].level;
+                out.print(",");
+                out.print(t);
+                out.print(pattern.segments[i].fade ? "~" : "=");
+                out.print(level);
+            }
+            t += pattern.segments[i].durationMs;
+            i = (i + 1) % pattern.count;
+        }
+    }
+    out.println();
+}
+
+#ifdef ARDUINO_ARCH_ESP32
+/**
+ * @brief Configures the RMT channel of the LED pin.
+ * @param pin The GPIO number.
+ */
+void RmtLedPatternBackend::begin(int pin)
+{
+    rmt = rmtInit(pin, RMT_TX_MODE, RMT_MEM_64);
+    if (rmt == NULL)
+    {
+        Serial.println("RMT init failed");
+        return;
+    }
+    tickNs = rmtSetTick(rmt, TICK_NS);
+}
+
+/**
+ * @brief Converts the pattern to RMT items and loops them.
+ *
+ * @param pattern The pattern, it must stay valid while it is played.
+ */
+void RmtLedPatternBackend::play(const LedPattern &pattern)
+{
+    if (rmt == NULL)
+    {
+        return;
+    }
+
+    // Longest duration of an item half, the duration fields are 15 bits wide
+    const uint32_t maxTicks = 0x7FFF;
+
+    // Split the segments in item halves, a fade switching to its level at its middle
+    uint8_t levels[MAX_ITEMS * 2];
+    uint16_t ticks[MAX_ITEMS * 2];
+    uint8_t halves = 0;
+    for (uint8_t i = 0; i < pattern.count && halves < MAX_ITEMS * 2; i++)
+    {
+        uint32_t durationMs = (pattern.count == 1) ? 1000 : pattern.segments[i].durationMs;
+        uint8_t parts = pattern.segments[i].fade ? 2 : 1;
+        for (uint8_t part = 0; part < parts; part++)
+        {
+            uint32_t partMs = (parts == 1) ? durationMs : (part == 0) ? durationMs / 2 : durationMs - durationMs / 2;
+            uint8_t level = (parts == 2 && part == 0) ? previousLevel(pattern, i) : pattern.segments[i].level;
+            uint32_t remaining = (uint32_t)(partMs * 1000000.0f / tickNs);
+            if (remaining == 0)
+            {
+                remaining = 1;
+            }
+            while (remaining > 0 && halves < MAX_ITEMS * 2)
+            {
+                uint32_t n = (remaining > maxTicks) ? maxTicks : remaining;
+                levels[halves] = level;
+                ticks[halves] = n;
+                halves++;
+                remaining -= n;
+            }
+        }
+    }
+
+    // An item needs two non zero halves
+    if (halves % 2 == 1)
+    {
+        if (halves == MAX_ITEMS * 2)
+        {
+            halves--;
+        }
+        else
+        {
+            uint16_t last = ticks[halves - 1];
+            ticks[halves - 1] = (last + 1) / 2;
+            levels[halves] = levels[halves - 1];
+            ticks[halves] = (last > 1) ? last / 2 : 1;
+            halves++;
+        }
+    }
+
+    for (uint8_t i = 0; i < halves / 2; i++)
+    {
+        items[i].level0 = levels[i * 2];
+        items[i].duration0 = ticks[i * 2];
+        items[i].level1 = levels[i * 2 + 1];
+        items[i].duration1 = ticks[i * 2 + 1];
+    }
+    rmtLoop(rmt, items, halves / 2);
+}
+
+#ifdef LED_PATTERN_LEDC
+/**
+ * @brief Configures the LEDC channel of the LED pin and starts the task playing the patterns.
+ * @param pin The GPIO number.
+ */
+void LedcLedPatternBackend::begin(int pin)
+{
+    ledcSetup(CHANNEL, FREQUENCY, RESOLUTION);
+    ledcAttachPin(pin, CHANNEL);
+    ledc_fade_func_install(0);
+
+    xTaskCreatePinnedToCore(
+        playTask,      // Task function
+        "LedPattern",  // Task name
+        2048,          // Stack size
+        this,          // Task parameter
+        1,             // Task priority
+        &task,         // Task handle
+        1);            // CPU core to run the task
+}
+
+/**
+ * @brief Hands the pattern over to the task, which starts it at once.
+ *
+ * @param pattern The pattern, it must stay valid while it is played.
+ */
+void LedcLedPatternBackend::play(const LedPattern &pattern)
+{
+    this->pattern.store(&pattern, std::memory_order_release);
+    if (task != NULL)
+    {
+        xTaskNotifyGive(task);
+    }
+}
+
+/**
+ * @brief Task function, plays the segments of the current pattern until a new one is notified.
+ *
+ * The wake-up time of each segment is computed from the start of the previous one, so the pattern
+ * does not drift. A single segment pattern sets the duty and waits for the next pattern.
+ *
+ * @param pvParameters Pointer to the LedcLedPatternBackend instance.
+ */
+void LedcLedPatternBackend::playTask(void *pvParameters)
+{
+    LedcLedPatternBackend *self = (LedcLedPatternBackend *)pvParameters;
+    const ledc_mode_t mode = (ledc_mode_t)(CHANNEL / 8);
+    const ledc_channel_t channel = (ledc_channel_t)(CHANNEL % 8);
+    const uint32_t maxDuty = (1 << RESOLUTION) - 1;
+
+    while (true)
+    {
+        const LedPattern *pattern = self->pattern.load(std::memory_order_acquire);
+        if (pattern == NULL)
+        {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+
+        uint8_t i = 0;
+        TickType_t segmentStart = xTaskGetTickCount();
+        TickType_t wait;
+        do
+        {
+            const LedSegment &segment = pattern->segments[i];
+            uint32_t duty = segment.level ? maxDuty : 0;
+            if (segment.fade && pattern->count > 1)
+            {
+                ledc_set_fade_with_time(mode, channel, duty, segment.durationMs);
+                ledc_fade_start(mode, channel, LEDC_FADE_NO_WAIT);
+            }
+            else
+            {
+                ledc_set_duty(mode, channel, duty);
+                ledc_update_duty(mode, channel);
+            }
+
+            if (pattern->count == 1)
+            {
+                wait = portMAX_DELAY;
+            }
+            else
+            {
+                segmentStart += pdMS_TO_TICKS(segment.durationMs);
+                TickType_t now = xTaskGetTickCount();
+                wait = ((int32_t)(segmentStart - now) > 0) ? segmentStart - now : 0;
+                i = (i + 1) % pattern->count;
+            }
+        } while (ulTaskNotifyTake(pdTRUE, wait) == 0);
+    }
+}
+#endif
+#endif
+
+/**
+ * @brief Nothing to configure on the mock.
+ */
+void MockLedPatternBackend::begin(int)
+{
+}
+
+/**
+ * @brief Records the pattern and its start time.
+ *
+ * @param pattern The pattern, it must stay valid while it is played.
+ */
+void MockLedPatternBackend::play(const LedPattern &pattern)
+{
+    this->pattern = &pattern;
+    startMs = millis();
+    plays++;
+}
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(LED_PATTERN_LEDC)
+/// Backend driving the status LED, with fades
+static LedcLedPatternBackend ledBackend;
+#elif defined(ARDUINO_ARCH_ESP32)
+/// Backend driving the status LED
+static RmtLedPatternBackend ledBackend;
+#else
+/// Backend driving the status LED
+static MockLedPatternBackend ledBackend;
+#endif
+
+/// Global backend driving the status LED
+LedPatternBackend &ledPatterns = ledBackend;
@@ -28,90 +28,130 @@
  *
  * This file contains the implementations of the functions required to manage an LED connected to a GPIO pin.
  * The LED can be in one of four states: OFF, READY, WAITING, or CONFIG, each causing different behavior in the LED.
- * The management of the LED state is handled by FreeRTOS tasks to ensure efficient multitasking.
+ * The blink patterns are played by the LED pattern engine, so no CPU time is spent on blinking.
  */
 
 #include "ledStatus.h"
-extern CustomDisplay display;
+#include "relayBank.h"
+#include "binaryProtocol.h"
+#include "commandStats.h"
 
-/// Positions of the joysticks on the display
-int joyPos[4] = {0, 1, 2, 3};
+/// Bitmask of the relays powering the buttons LEDs (odd relays)
+static const uint8_t LED_RELAYS = 0xAA;
 
-/// Current status of the LED
-volatile LedStatus currentStatus = OFF;
+/// Current status of the LED, WAITING until the handshake like the initial controller state
+std::atomic<LedStatus> currentStatus(WAITING);
 
-/// Handle for the LED management task
-TaskHandle_t Task1;
+#ifdef LED_PATTERN_LEDC
+/// Segments of the WAITING pattern, breathing in for 400 ms and out for 800 ms
+static const LedSegment WAITING_SEGMENTS[] = {{HIGH, 400, true}, {LOW, 800, true}};
+#else
+/// Segments of the WAITING pattern, on for 200 ms and off for 1000 ms
+static const LedSegment WAITING_SEGMENTS[] = {{HIGH, 200, false}, {LOW, 1000, false}};
+#endif
+
+/// Segments of the CONFIG pattern, on for 25 ms and off for 100 ms
+static const LedSegment CONFIG_SEGMENTS[] = {{HIGH, 25, false}, {LOW, 100, false}};
+
+/// Segment of the steady off pattern
+static const LedSegment OFF_SEGMENTS[] = {{LOW, 0, false}};
+
+/// Segment of the steady on pattern
+static const LedSegment READY_SEGMENTS[] = {{HIGH, 0, false}};
+
+/// Blink pattern of each status, indexed by LedStatus
+const LedPattern LED_PATTERNS[] = {
+    {OFF_SEGMENTS, 1},     // OFF
+    {READY_SEGMENTS, 1},   // READY
+    {WAITING_SEGMENTS, 2}, // WAITING
+    {CONFIG_SEGMENTS, 2},  // CONFIG
+};
+
+/// Start of the current statistics window, value of millis()
+static unsigned long ledStatsStart = 0;
+
+/// Number of status changes applied to the LED
+static volatile uint32_t ledChanges = 0;
+
+/// Sum of the times taken to start the new pattern, in microseconds
+static volatile uint32_t ledLatencySum = 0;
+
+/// Maximum time taken to start the new pattern, in microseconds
+static volatile uint32_t ledLatencyMax = 0;
 
 /**
- * @brief Task function to manage the LED behavior based on the current status.
+ * @brief Changes the LED status and starts its blink pattern.
  *
- * This function runs in an infinite loop, checking the current status of the LED and
- * updating its state accordingly. The behavior of the LED changes depending on the value of currentStatus.
+ * The pattern is played by the LED pattern backend, so there is nothing left to do until the next
+ * status change.
  *
- * @param pvParameters Pointer to the parameters passed to the task (not used in this case).
+ * @param status The new LED status.
  */
-void manageLED(void *pvParameters)
+void setLedStatus(LedStatus status)
 {
-  while (1)
+  unsigned long start = micros();
+  currentStatus.store(status, std::memory_order_release);
+  ledPatterns.play(LED_PATTERNS[status]);
+
+  uint32_t latency = micros() - start;
+  ledChanges = ledChanges + 1;
+  ledLatencySum = ledLatencySum + latency;
+  if (latency > ledLatencyMax)
   {
-    switch (currentStatus)
-    {
-    case OFF:
-      digitalWrite(ledPin, LOW);
-      vTaskDelay(100 / portTICK_PERIOD_MS); // Check every 100 ms
-      break;
-    case READY:
-      digitalWrite(ledPin, HIGH);
-      vTaskDelay(100 / portTICK_PERIOD_MS); // Check every 100 ms
-      break;
-    case WAITING:
-      digitalWrite(ledPin, HIGH);
-      vTaskDelay(200 / portTICK_PERIOD_MS); // On for 200 ms
-      digitalWrite(ledPin, LOW);
-      vTaskDelay(1000 / portTICK_PERIOD_MS); // Off for 1000 ms
-      break;
-    case CONFIG:
-      digitalWrite(ledPin, HIGH);
-      vTaskDelay(25 / portTICK_PERIOD_MS); // On for 25 ms
-      digitalWrite(ledPin, LOW);
-      vTaskDelay(100 / portTICK_PERIOD_MS); // Off for 100 ms
-      break;
-    }
+    ledLatencyMax = latency;
   }
 }
+
+/**
+ * @brief Prints the status changes and the time taken to start their pattern, then restarts the statistics.
+ *
+ * Output format: LED:changes=<n>,per_s=<changes per second x1000>,avg=<us>,max=<us>
+ */
+void printLedStats()
+{
+  unsigned long now = millis();
+  unsigned long window = now - ledStatsStart;
+
+  console.print("LED:changes=");
+  console.print((uint32_t)ledChanges);
+  console.print(",per_s=");
+  console.print(window > 0 ? (uint32_t)((uint64_t)ledChanges * 1000000 / window) : 0);
+  console.print(",avg=");
+  console.print(ledChanges > 0 ? (uint32_t)(ledLatencySum / ledChanges) : 0);
+  console.print(",max=");
+  console.println((uint32_t)ledLatencyMax);
+
+  ledStatsStart = now;
+  ledChanges = 0;
+  ledLatencySum = 0;
+  ledLatencyMax = 0;
+}
+
 /**
  * @brief Initializes the LED pin, serial communication, and creates the FreeRTOS tasks.
  *
  * Joysticks and LEDs are connected to the Normally Connected pins of the relays
  * So Output shoud be LOW to to disconnect the device
+ *
+ * @param staggered Whether to release the relays two by two, 500 ms apart, instead of all at once.
  */
-void disconnectAllRelays()
+void disconnectAllRelays(bool staggered)
 {
   // Disconnect all USB boards
+  relays.begin();
 
-  pinMode(RELAY1, OUTPUT);
-  pinMode(RELAY2, OUTPUT);
-  pinMode(RELAY3, OUTPUT);
-  pinMode(RELAY4, OUTPUT);
-  pinMode(RELAY5, OUTPUT);
-  pinMode(RELAY6, OUTPUT);
-  pinMode(RELAY7, OUTPUT);
-  pinMode(RELAY8, OUTPUT);
-
-
-  digitalWrite(RELAY1, LOW);
-  digitalWrite(RELAY2, LOW);
-  delay(500);
-  digitalWrite(RELAY3, LOW);
-  digitalWrite(RELAY4, LOW);
-  delay(500);
-  digitalWrite(RELAY5, LOW);
-  digitalWrite(RELAY6, LOW);
-  delay(500);
-  digitalWrite(RELAY7, LOW);
-  digitalWrite(RELAY8, LOW);
-  delay(500);
+  if (staggered)
+  {
+    for (int currentRelay = 0; currentRelay < 8; currentRelay += 2)
+    {
+      relays.update(3 << currentRelay, 0);
+      delay(500);
+    }
+  }
+  else
+  {
+    relays.apply(0);
+  }
 
   Serial.print("Test");
 }
@@ -119,13 +159,12 @@ void disconnectAllRelays()
 /**
  * @brief Activates LEDs based on the number of players.
  *
- * This function turns on the appropriate number of LEDs based on the number of players.
- * It also updates the display to show the status of each LED.
+ * This function connects the buttons LEDs of the first nbPlayers joysticks. The matching icons are
+ * drawn by joystickScreen().
  *
  * @param nbPlayers The number of players.
- * @param showStatus Whether to show the status on the display.
  */
-void activateLeds(int nbPlayers, bool showStatus)
+void activateLeds(int nbPlayers)
 {
   if (nbPlayers > 4)
   {
@@ -136,57 +175,29 @@ void activateLeds(int nbPlayers, bool showStatus)
     nbPlayers = 0;
   }
 
-  bool ledStatus[4] = {false, false, false, false};
+  uint8_t ledRelays = 0;
   for (int currentJoy = 0; currentJoy < nbPlayers; currentJoy++)
   {
-    ledStatus[currentJoy] = true;
-  }
-  for (int currentJoy = 0; currentJoy < 4; currentJoy++)
-  {
-    if (ledStatus[currentJoy])
-    {
-      if (showStatus)
-      {
-        // Display a connected status for this joystick on the OLED
-        display.drawXBMP(joyPos[currentJoy] * 32, 32, Joystick_icon_width, Joystick_icon_width, JoyON[currentJoy]);
-        // Physically connect the LEDs for this joystick
-        digitalWrite(RELAY[currentJoy * 2 + 1], HIGH);
-      }
-    }
-    else
-    {
-      if (showStatus)
-      {
-        // Display a disconnected status for this Joystick on the OLED
-        display.drawXBMP(joyPos[currentJoy] * 32, 32, Joystick_icon_width, Joystick_icon_width, JoyOFF[currentJoy]);
-        // Physically disconnect the LEDs for this joystick
-        digitalWrite(RELAY[currentJoy * 2 + 1], LOW);
-      }
-    }
+    // Connect the LEDs for this joystick
+    ledRelays |= 1 << (currentJoy * 2 + 1);
   }
+
+  // Physically connect or disconnect the LEDs, only the relays that change are written
+  relays.update(LED_RELAYS, ledRelays);
+  statsRecord(STAGE_RELAY);
 }
 
 /**
- * @brief Initializes the LED pin, serial communication, and creates the FreeRTOS tasks.
+ * @brief Initializes the LED pattern backend and serial communication.
  *
- * This function sets up the necessary hardware and tasks for managing the LED.
+ * This function sets up the necessary hardware for managing the LED.
  */
 void setupLED()
 {
-  // Initialize pin
-  pinMode(ledPin, OUTPUT);
-  digitalWrite(ledPin, LOW);
+  // Initialize the LED and show the current status
+  ledPatterns.begin(ledPin);
+  ledPatterns.play(LED_PATTERNS[currentStatus.load(std::memory_order_acquire)]);
 
   // Initialize serial port
   Serial.begin(115200);
-
-  // Create tasks
-  xTaskCreatePinnedToCore(
-      manageLED,    // Task function
-      "Manage LED", // Task name
-      1024,         // Stack size
-      NULL,         // Task parameter
-      1,            // Task priority
-      &Task1,       // Task handle
-      1);           // CPU core to run the task
 }
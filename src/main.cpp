@@ -33,169 +33,385 @@
 #include <Arduino.h>
 // #include <SPI.h>
 #include "powerManagement.h"
-#include "images.h"
 #include "ledStatus.h"
 #include "bitmapManager.h"
 #include "display.h" // Assuming CustomDisplay and display instance are declared here
+#include "commandParser.h"
+#include "serialReceiver.h"
+#include "bringUp.h"
+#include "binaryProtocol.h"
+#include "controller.h"
+#include "commandStats.h"
+#include "trace.h"
 CustomDisplay display(U8G2_R0, /* reset=*/I2CRESET, /* clock=*/I2CSCL, /* data=*/I2CSDA);
+
+/// Time after which a line without newline is handled anyway, same as the Stream default timeout
+const unsigned long SERIAL_LINE_TIMEOUT_MS = 1000;
+
+/// Parser holding the serial bytes received and not yet handled
+CommandParser commandParser;
+
+/// Time of the last received serial byte
+unsigned long lastRxTime = 0;
+
+/// Decoder of the packets received in binary mode
+PacketDecoder packetDecoder;
+
+// Setup ==================================================
 /**
- * @brief Initializes the joystick with the given number.
- * @param joystickNum The number of the joystick to initialize.
+ * @brief Prints the duration of each boot phase over serial.
+ *
+ * Output format: BOOT:start=<ms>,relays=<ms>,serial=<ms>,display=<ms>,logo=<ms>,screen=<ms>,total=<ms>
+ * where start is the time spent before setup() and total the time from reset to the waiting screen.
+ *
+ * @param marks Value of millis() at the start of setup() and at the end of each phase.
  */
-void initJoystick(int joystickNum);
+void printBootTimes(const unsigned long marks[6])
+{
+  static const char *const names[] = {"relays", "serial", "display", "logo", "screen"};
+
+  Serial.print("BOOT:start=");
+  Serial.print(marks[0]);
+  for (int phase = 0; phase < 5; phase++)
+  {
+    Serial.print(',');
+    Serial.print(names[phase]);
+    Serial.print('=');
+    Serial.print(marks[phase + 1] - marks[phase]);
+  }
+  Serial.print(",total=");
+  Serial.println(marks[5]);
+}
 
-// Setup ==================================================
 /**
  * @brief Setup function called once at startup.
  *
  * This function initializes serial communication, the OLED display, and the LED management system.
+ * With FAST_BOOT, the relays are all released first and settle while the other peripherals are
+ * initialized, the logo only stays on screen until RELAY_SETTLE_MS has elapsed since their release.
  */
 void setup()
 {
-  disconnectAllRelays();
+  unsigned long bootMarks[6];
+  bootMarks[0] = millis();
+
+  disconnectAllRelays(!FAST_BOOT);
+  bootMarks[1] = millis();
 
   // Initialize serial communication
   Serial.begin(115200);
 
-  while (!Serial)
+  if (!FAST_BOOT)
   {
-    ; // Wait for the serial port to be ready
+    while (!Serial)
+    {
+      ; // Wait for the serial port to be ready
+    }
   }
   Serial.println("ESP32 ready to receive messages...");
 
   // Setup LED management
   setupLED();
 
+  // Wake up the main loop only when serial data is received
+  setupSerialReceiver();
+  bootMarks[2] = millis();
+
   // Power on the external voltage (Vext)
   VextON();
   delay(100);
 
-  // Initialize the display
+  // Initialize the display, then hand the I2C transfers over to the render task
   display.begin();
+  display.startRenderTask();
+  bootMarks[3] = millis();
 
   // Display the loading screen
-  loadingScreen();
+  if (FAST_BOOT)
+  {
+    drawLoadingScreen();
+
+    // Keep the logo until the relays released at boot have settled
+    unsigned long elapsed = millis() - bootMarks[1];
+    if (elapsed < RELAY_SETTLE_MS)
+    {
+      delay(RELAY_SETTLE_MS - elapsed);
+    }
+  }
+  else
+  {
+    loadingScreen();
+  }
+  bootMarks[4] = millis();
 
   // Display the waiting screen
   waitingScreen();
+  bootMarks[5] = millis();
+
+  printBootTimes(bootMarks);
+}
+
+// Main loop =============================================
+/**
+ * @brief Sends the acknowledgement of a command back on the serial port.
+ *
+ * A text command is acknowledged with its text, written straight from the parser buffer without
+ * building a String. A binary command gets an OP_ACK packet.
+ *
+ * @param cmd The command to acknowledge.
+ */
+void sendAck(const Command &cmd)
+{
+  if (cmd.seq >= 0)
+  {
+    const uint8_t payload[2] = {ACK_OK, (uint8_t)cmd.event};
+    sendPacket(Serial, cmd.seq, OP_ACK, payload, 2);
+    statsRecord(STAGE_ACK);
+    trace(TRACE_ACK, cmd.event, 1);
+    return;
+  }
+  Serial.print("ACK:");
+  Serial.write((const uint8_t *)cmd.text, cmd.length);
+  Serial.println();
+  statsRecord(STAGE_ACK);
+  trace(TRACE_ACK, cmd.event, 1);
 }
 
 /**
- * @brief Initializes the joystick with the given number.
- * @param joystickNum The number of the joystick to initialize.
+ * @brief Sends the acknowledgement of a command as its event letter alone (ACK:S for S).
+ * @param cmd The command to acknowledge.
  */
+void sendEventAck(const Command &cmd)
+{
+  if (cmd.seq >= 0)
+  {
+    sendAck(cmd);
+    return;
+  }
+  Serial.print("ACK:");
+  Serial.println(cmd.event);
+  statsRecord(STAGE_ACK);
+  trace(TRACE_ACK, cmd.event, 1);
+}
 
-void initJoystick(int joystickNum)
+/**
+ * @brief Tells the host that a command is unknown or refused in the current state.
+ * @param cmd The refused command.
+ */
+void sendNack(const Command &cmd)
 {
-  int progress = joystickNum * 25;
-  // Draw the progress bar
-  display.drawProgressBar(5, 42, 116, 10, progress);
-
-  // Physically reconnect the joystick and the buttons LEDS
-  digitalWrite(RELAY[joystickNum * 2 - 2], HIGH);
-  delay(1000);
-  digitalWrite(RELAY[joystickNum * 2 - 1], HIGH);
-  delay(1000);
+  trace(TRACE_ACK, cmd.event, 0);
+  if (cmd.seq >= 0)
+  {
+    const uint8_t payload[2] = {ACK_REFUSED, (uint8_t)cmd.event};
+    sendPacket(Serial, cmd.seq, OP_ACK, payload, 2);
+    return;
+  }
+  Serial.println("ACK:?");
 }
 
-// Main loop =============================================
 /**
- * @brief Main loop function called repeatedly.
+ * @brief Answers a received command and feeds it to the controller state machine.
+ *
+ * N/L/Q commands are acknowledged right away but only their player count is kept, the update is
+ * rendered by flushPlayers() once the batch of received commands is handled, or before any other
+ * command so the screens keep their order.
  *
- * This function checks for incoming serial messages and updates the OLED display and LED status based on the received messages.
+ * @param cmd The command to handle.
  */
-
-void loop()
+void handleCommand(const Command &cmd)
 {
-  // Check if data is available on the serial port
-  if (Serial.available() > 0)
+  ControllerEvent event = commandEvent(cmd.event);
+  if (event != EV_PLAYERS)
   {
-    // Read the message
-    String message = Serial.readStringUntil('\n');
-    message.trim(); // Call trim() on a separate line
+    flushPlayers();
+  }
 
-    if (message == "ESP32?")
+  if (cmd.equals("ESP32?") || cmd.equals("ESP32?BIN"))
+  {
+    // The handshake selects the protocol, the answer is sent in text when the mode changes
+    bool binary = cmd.equals("ESP32?BIN");
+    statsBeginCommand(EV_HANDSHAKE);
+    trace(TRACE_COMMAND, 'H');
+    if (!binary)
     {
-      Serial.println("ESP32 ready");
-      currentStatus = CONFIG;
+      console.setBinary(false);
+    }
+    console.println(binary ? "ESP32 ready BIN" : "ESP32 ready");
+    console.setBinary(binary);
+    statsRecord(STAGE_ACK);
 
-      for (int currentJoystick = 1; currentJoystick < 5; currentJoystick++)
-      {
-        // Clear the display buffer
-        display.clearBuffer();
+    // Reconnect the joysticks, progress is reported while loop() keeps running
+    controllerDispatch(EV_HANDSHAKE);
+  }
+  else if (cmd.equals("RX?"))
+  {
+    printRxStats();
+  }
+  else if (cmd.equals("LED?"))
+  {
+    printLedStats();
+  }
+  else if (cmd.equals("STATE?"))
+  {
+    printStateStats();
+  }
+  else if (cmd.equals("STATS?"))
+  {
+    printCommandStats();
+  }
+  else if (cmd.equals("TRACE?"))
+  {
+    printTrace();
+  }
+  else if (cmd.equals("STATS!"))
+  {
+    resetCommandStats();
+    console.println("STATS:RESET");
+  }
+  else if (event == EV_COUNT)
+  {
+    // Unknown command
+    sendNack(cmd);
+  }
+  else
+  {
+    // Time the stages of the command from its reception
+    statsBeginCommand(event);
+    trace(TRACE_COMMAND, cmd.event, (uint16_t)cmd.value);
+    if (!controllerAccepts(event))
+    {
+      // Not valid in the current state (joysticks being reconnected...)
+      sendNack(cmd);
+      controllerDispatch(event, cmd.value); // Counted as rejected
+      return;
+    }
+
+    // Acknowledge before drawing, the host does not wait for the screen
+    if (event == EV_PLAYERS)
+    {
+      sendAck(cmd);
+    }
+    else
+    {
+      sendEventAck(cmd);
+    }
+    controllerDispatch(event, cmd.value);
+  }
+}
+
+/**
+ * @brief Converts a binary packet into a command and handles it.
+ *
+ * An OP_TEXT packet is parsed like a text line, a command opcode takes its value from the payload.
+ *
+ * @param packet The packet received.
+ */
+void handlePacket(const Packet &packet)
+{
+  Command cmd;
+  if (packet.opcode == OP_TEXT)
+  {
+    cmd.parse((const char *)packet.payload, packet.length);
+  }
+  else
+  {
+    cmd.text = (const char *)&packet.opcode;
+    cmd.length = 1;
+    cmd.event = (char)packet.opcode;
+    int32_t value = 0;
+    if (packet.length >= 4)
+    {
+      value = (int32_t)((uint32_t)packet.payload[0] | (uint32_t)packet.payload[1] << 8 |
+                        (uint32_t)packet.payload[2] << 16 | (uint32_t)packet.payload[3] << 24);
+    }
+    cmd.value = value;
+  }
+  cmd.seq = packet.seq;
 
-        // Draw the status screen
-        statusScreen();
+  markDispatch();
+  handleCommand(cmd);
+}
 
-        // Initialize the joystick
-        initJoystick(currentJoystick);
+/**
+ * @brief Handles every complete line waiting in the parser ring.
+ */
+void handleLines()
+{
+  Command cmd;
+  while (commandParser.next(cmd))
+  {
+    markDispatch();
+    handleCommand(cmd);
+  }
+}
 
-        // Send the buffer content to the display
-        display.sendBuffer();
+/**
+ * @brief Main loop function called repeatedly.
+ *
+ * This function advances the joystick bring-up, sleeps until the UART reports received data or the
+ * next bring-up step is due, feeds the incoming serial bytes to the command parser and handles each
+ * line as soon as its newline is received, so a burst longer than the ring is not lost. In binary
+ * mode the bytes go to the packet decoder and each packet is handled as soon as it is complete, so
+ * pipelined commands are acknowledged in order. Player count updates of a batch are collapsed into
+ * a single render at its end.
+ * A line left without newline is handled once the port has been idle for SERIAL_LINE_TIMEOUT_MS,
+ * like Serial.readStringUntil() used to do.
+ */
 
-        // Wait for 1 second
-        delay(1000);
-      }
-      currentStatus = READY;
-      readyScreen();
-    }
-    else if ((message.charAt(0) == 'N' || message.charAt(0) == 'L' || message.charAt(0) == 'Q') && currentStatus == READY)
-    {
-      // Extract the number of players from the message
-      int separatorIndex = message.indexOf(':');
-      String nbPlayersStr = message.substring(separatorIndex + 1);
-      int nbPlayers = nbPlayersStr.toInt();
+void loop()
+{
+  // Run the bring-up steps that are due
+  uint32_t timeout = serviceBringUp();
 
-      // Handle the message based on the event
-      char event = message.charAt(0);
-      String ack = "ACK:" + String(message);
+  // Sleep until data is received, the next bring-up step or the pending partial line timeout
+  if (Serial.available() == 0)
+  {
+    if (commandParser.hasPartialLine())
+    {
+      unsigned long elapsed = millis() - lastRxTime;
+      unsigned long lineTimeout = elapsed < SERIAL_LINE_TIMEOUT_MS ? SERIAL_LINE_TIMEOUT_MS - elapsed : 0;
+      timeout = min(timeout, (uint32_t)lineTimeout);
+    }
+    waitForSerial(timeout);
+  }
 
-      switch (event)
+  // Move the received bytes into the parser ring, or decode them in binary mode
+  while (Serial.available() > 0)
+  {
+    uint8_t c = (uint8_t)Serial.read();
+    lastRxTime = millis();
+    if (console.binary())
+    {
+      Packet packet;
+      if (packetDecoder.push(c, packet))
       {
-      case 'N':
-      case 'L':
-      case 'Q':
-        display.clearBuffer();
-        joystickScreen();
-        activateLeds(nbPlayers);
-        display.sendBuffer();
-        break;
-      default:
-        ack = "ACK:?";
-        break;
+        handlePacket(packet);
       }
-      Serial.println(ack);
     }
     else
     {
-      // Handle other messages
-      switch (message.charAt(0))
+      if (!commandParser.push((char)c))
       {
-      case 'S':
-        Serial.println("ACK:S"); // Starting
-        startingScreen();
-        activateLeds(0);
-        break;
-      case 'D':
-        Serial.println("ACK:D"); // Started
-        startingScreen();
-        activateLeds(0);
-        break;
-      case 'E':
-        Serial.println("ACK:E"); // stopping
-        stoppingScreen();
-        activateLeds(4);
-        break;
-      case 'P':
-        Serial.println("ACK:P"); // stopped
-        stoppedScreen();
-        activateLeds(0);
-        break;
-      default:
-        Serial.println("ACK:?");
-        // Do nothing with buttons LEDs
-        break;
+        handleLines();
+        commandParser.push((char)c);
+      }
+      if (c == '\n')
+      {
+        handleLines();
       }
     }
   }
+
+  if (commandParser.hasPartialLine() && millis() - lastRxTime >= SERIAL_LINE_TIMEOUT_MS)
+  {
+    commandParser.push('\n');
+  }
+
+  // Handle the line completed by the timeout
+  handleLines();
+
+  // Render the final player count of the batch, in one relay update and one frame
+  flushPlayers();
+  statsEndCommand();
 }
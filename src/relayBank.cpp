@@ -0,0 +1,218 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file relayBank.cpp
+ * @brief Source file for the relay bank driver.
+ *
+ * This file contains the diff computation of the relay bank and the GPIO register and mock backends.
+ */
+
+#include "relayBank.h"
+#include "firmware_config.h"
+#include "trace.h"
+#ifdef ARDUINO_ARCH_ESP32
+#include <soc/gpio_struct.h>
+#endif
+
+/**
+ * @brief Configures a pin as output.
+ * @param pin The GPIO number.
+ */
+void GpioRelayBackend::configure(int pin)
+{
+    pinMode(pin, OUTPUT);
+}
+
+/**
+ * @brief Sets and clears GPIOs of a bank in one go, through the W1TS/W1TC registers.
+ *
+ * @param bank GPIO bank, 0 for GPIO 0-31 and 1 for GPIO 32 and above.
+ * @param setMask Bits of the GPIOs to drive HIGH.
+ * @param clearMask Bits of the GPIOs to drive LOW.
+ */
+void GpioRelayBackend::write(uint8_t bank, uint32_t setMask, uint32_t clearMask)
+{
+#ifdef ARDUINO_ARCH_ESP32
+    if (bank == 0)
+    {
+        if (setMask)
+        {
+            GPIO.out_w1ts = setMask;
+        }
+        if (clearMask)
+        {
+            GPIO.out_w1tc = clearMask;
+        }
+    }
+    else
+    {
+        if (setMask)
+        {
+            GPIO.out1_w1ts.val = setMask;
+        }
+        if (clearMask)
+        {
+            GPIO.out1_w1tc.val = clearMask;
+        }
+    }
+#else
+    // No register access outside the ESP32, fall back on the Arduino API
+    for (int bit = 0; bit < 32; bit++)
+    {
+        if (setMask & (1UL << bit))
+        {
+            digitalWrite(bank * 32 + bit, HIGH);
+        }
+        if (clearMask & (1UL << bit))
+        {
+            digitalWrite(bank * 32 + bit, LOW);
+        }
+    }
+#endif
+}
+
+/**
+ * @brief Nothing to configure on the mock.
+ */
+void MockRelayBackend::configure(int)
+{
+}
+
+/**
+ * @brief Records the new GPIO levels and counts the register writes.
+ *
+ * @param bank GPIO bank, 0 for GPIO 0-31 and 1 for GPIO 32 and above.
+ * @param setMask Bits of the GPIOs to drive HIGH.
+ * @param clearMask Bits of the GPIOs to drive LOW.
+ */
+void MockRelayBackend::write(uint8_t bank, uint32_t setMask, uint32_t clearMask)
+{
+    level[bank] = (level[bank] | setMask) & ~clearMask;
+    registerWrites += (setMask ? 1 : 0) + (clearMask ? 1 : 0);
+    lastWriteUs = micros();
+}
+
+RelayBank::RelayBank(const int *pins, uint8_t count, RelayBackend &backend)
+    : pins(pins), count(count), backend(backend)
+{
+}
+
+/**
+ * @brief Configures the relay pins as outputs.
+ *
+ * The shadow state is invalidated, each relay is written the next time it is updated.
+ */
+void RelayBank::begin()
+{
+    for (uint8_t relay = 0; relay < count; relay++)
+    {
+        backend.configure(pins[relay]);
+    }
+    known = 0;
+}
+
+/**
+ * @brief Drives all relays to the given state, writing only the ones that change.
+ * @param target Bitmask of the relays to turn on.
+ */
+void RelayBank::apply(uint8_t target)
+{
+    write((uint8_t)((1 << count) - 1), target);
+}
+
+/**
+ * @brief Drives a subset of the relays, leaving the others untouched.
+ *
+ * Relays outside the mask are not written even when their level is not known yet, so a staggered
+ * sequence right after begin() only switches the relays of each step.
+ *
+ * @param mask Bitmask of the relays to update.
+ * @param values Bitmask of the relays to turn on, among the ones of mask.
+ */
+void RelayBank::update(uint8_t mask, uint8_t values)
+{
+    write(mask & (uint8_t)((1 << count) - 1), values);
+}
+
+/**
+ * @brief Writes the relays of a subset that differ from the target or are not known yet.
+ *
+ * The changed relays are gathered into one set mask and one clear mask per GPIO bank, so relays
+ * switching together change at the same instant.
+ *
+ * @param mask Bitmask of the relays to update.
+ * @param target Bitmask of the relays to turn on, among the ones of mask.
+ */
+void RelayBank::write(uint8_t mask, uint8_t target)
+{
+    uint8_t changed = (uint8_t)((target ^ shadow) | ~known) & mask;
+    if (changed == 0)
+    {
+        return;
+    }
+
+    uint32_t setMask[2] = {0, 0};
+    uint32_t clearMask[2] = {0, 0};
+    for (uint8_t relay = 0; relay < count; relay++)
+    {
+        if (!(changed & (1 << relay)))
+        {
+            continue;
+        }
+        int pin = pins[relay];
+        if (target & (1 << relay))
+        {
+            setMask[pin >> 5] |= 1UL << (pin & 31);
+        }
+        else
+        {
+            clearMask[pin >> 5] |= 1UL << (pin & 31);
+        }
+    }
+
+    for (uint8_t bank = 0; bank < 2; bank++)
+    {
+        if (setMask[bank] || clearMask[bank])
+        {
+            backend.write(bank, setMask[bank], clearMask[bank]);
+            writes += (setMask[bank] ? 1 : 0) + (clearMask[bank] ? 1 : 0);
+        }
+    }
+
+    shadow = (shadow & ~changed) | (target & changed);
+    known |= changed;
+    trace(TRACE_RELAYS, shadow, changed);
+}
+
+#if defined(ARDUINO_ARCH_ESP32) || defined(NATIVE)
+/// Backend driving the relays, through the virtual GPIOs on the host
+static GpioRelayBackend relayBackend;
+#else
+/// Backend driving the relays
+static MockRelayBackend relayBackend;
+#endif
+
+/// Global relay bank driving the RELAY table of firmware_config.h
+RelayBank relays(RELAY, 8, relayBackend);
@@ -0,0 +1,200 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file serialReceiver.cpp
+ * @brief Source file for the event-driven serial receive path.
+ *
+ * The UART driver calls onSerialReceive() from its event task when its RX FIFO fills up or when the
+ * line stays idle after some bytes (end of a command). The callback only timestamps the event and
+ * notifies the loop task, which then drains Serial into the command parser.
+ */
+
+#include "serialReceiver.h"
+#include "binaryProtocol.h"
+#include "spscQueue.h"
+#include <esp_timer.h>
+
+/// Task running loop(), woken up by the receive callback
+static TaskHandle_t loopTask = NULL;
+
+/// Times of the UART receive events not yet seen by the loop task, in microseconds
+static SpscQueue<int64_t, 16> rxEventTimes;
+
+/// Time of the last UART receive event seen by the loop task, in microseconds
+static int64_t rxEventTime = 0;
+
+/// Number of UART receive events
+static uint32_t rxEvents = 0;
+
+/// Start of the current statistics window, in microseconds
+static int64_t statsStart = 0;
+
+/// Time spent blocked in waitForSerial() during the current window, in microseconds
+static int64_t idleTime = 0;
+
+/// Number of times the loop task was woken up by received data
+static uint32_t wakeups = 0;
+
+/// Number of dispatched commands
+static uint32_t dispatched = 0;
+
+/// Number of commands whose rendering was skipped because a later command superseded them
+static uint32_t coalesced = 0;
+
+/// Sum of the receive-to-dispatch latencies, in microseconds
+static int64_t latencySum = 0;
+
+/// Maximum receive-to-dispatch latency, in microseconds
+static uint32_t latencyMax = 0;
+
+/**
+ * @brief UART receive callback, runs in the UART event task.
+ *
+ * The event time is handed to the loop task through a lock-free queue, the UART event task may
+ * run on the other core. When the queue is full the event is only used to wake up the loop task.
+ */
+static void onSerialReceive()
+{
+    rxEventTimes.push(esp_timer_get_time());
+    xTaskNotifyGive(loopTask);
+}
+
+/**
+ * @brief Moves the receive events queued by the callback into the statistics of the loop task.
+ */
+static void collectRxEvents()
+{
+    int64_t time;
+    while (rxEventTimes.pop(time))
+    {
+        rxEventTime = time;
+        rxEvents++;
+    }
+}
+
+/**
+ * @brief Registers the UART receive callback waking up the calling task.
+ *
+ * The callback is triggered on FIFO full as well as on RX timeout, so long bursts are drained
+ * before the driver buffer overflows.
+ */
+void setupSerialReceiver()
+{
+    loopTask = xTaskGetCurrentTaskHandle();
+    statsStart = esp_timer_get_time();
+    Serial.onReceive(onSerialReceive, false);
+}
+
+/**
+ * @brief Blocks the calling task until serial data is received or the timeout expires.
+ *
+ * A notification given while the task was busy is kept by FreeRTOS, so data arriving between the
+ * last Serial.available() check and this call is never missed.
+ *
+ * @param timeoutMs Maximum time to wait in milliseconds, portMAX_DELAY to wait forever.
+ * @return true if woken up by received data.
+ */
+bool waitForSerial(uint32_t timeoutMs)
+{
+    TickType_t ticks = (timeoutMs == portMAX_DELAY) ? portMAX_DELAY : pdMS_TO_TICKS(timeoutMs);
+
+    int64_t start = esp_timer_get_time();
+    bool notified = ulTaskNotifyTake(pdTRUE, ticks) > 0;
+    idleTime += esp_timer_get_time() - start;
+
+    if (notified)
+    {
+        wakeups++;
+    }
+    return notified;
+}
+
+/**
+ * @brief Records the dispatch of a command received after the last UART event.
+ */
+void markDispatch()
+{
+    collectRxEvents();
+    uint32_t latency = (uint32_t)(esp_timer_get_time() - rxEventTime);
+    dispatched++;
+    latencySum += latency;
+    if (latency > latencyMax)
+    {
+        latencyMax = latency;
+    }
+}
+
+/**
+ * @brief Time of the last UART receive event seen by the loop task.
+ */
+int64_t rxEventTimestamp()
+{
+    collectRxEvents();
+    return rxEventTime;
+}
+
+/**
+ * @brief Records a command superseded by a later one of the same batch.
+ */
+void markCoalesced()
+{
+    coalesced++;
+}
+
+/**
+ * @brief Prints the idle time and receive-to-dispatch latency statistics, then restarts them.
+ *
+ * Output format: RX:idle=<per mille>,events=<n>,wakeups=<n>,lines=<n>,coalesced=<n>,avg=<us>,max=<us>
+ */
+void printRxStats()
+{
+    int64_t now = esp_timer_get_time();
+    int64_t window = now - statsStart;
+    collectRxEvents();
+
+    console.print("RX:idle=");
+    console.print((uint32_t)(window > 0 ? idleTime * 1000 / window : 0));
+    console.print(",events=");
+    console.print(rxEvents);
+    console.print(",wakeups=");
+    console.print(wakeups);
+    console.print(",lines=");
+    console.print(dispatched);
+    console.print(",coalesced=");
+    console.print(coalesced);
+    console.print(",avg=");
+    console.print((uint32_t)(dispatched > 0 ? latencySum / dispatched : 0));
+    console.print(",max=");
+    console.println(latencyMax);
+
+    statsStart = now;
+    idleTime = 0;
+    rxEvents = 0;
+    wakeups = 0;
+    dispatched = 0;
+    coalesced = 0;
+    latencySum = 0;
+    latencyMax = 0;
+}
@@ -0,0 +1,110 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file trace.cpp
+ * @brief Source file for the in-RAM event trace.
+ *
+ * This file contains the trace ring and its dump.
+ */
+
+#include "trace.h"
+#include "binaryProtocol.h"
+#include <atomic>
+
+/// Ring of the last records
+static TraceRecord records[TRACE_SIZE];
+
+/// Number of records claimed since boot, the next slot is written at traceHead % TRACE_SIZE
+static std::atomic<uint32_t> traceHead(0);
+
+/**
+ * @brief Records an event, from any task.
+ *
+ * The slot is claimed with an atomic increment, so records from several tasks or cores never share
+ * a slot. A record being written while the ring is dumped may appear torn in the dump.
+ *
+ * @param event The TraceEvent.
+ * @param arg8 First argument.
+ * @param arg16 Second argument.
+ */
+void trace(uint8_t event, uint8_t arg8, uint16_t arg16)
+{
+    uint32_t index = traceHead.fetch_add(1, std::memory_order_relaxed) & (TRACE_SIZE - 1);
+    TraceRecord &record = records[index];
+    record.time = micros();
+    record.event = event;
+    record.arg8 = arg8;
+    record.arg16 = arg16;
+}
+
+/**
+ * @brief Prints the records of the ring, oldest first, as hexadecimal lines.
+ *
+ * Output format:
+ * TRACE:BEGIN,count=<records since boot>,now=<micros()>
+ * TRACE:<record><record>... up to 8 records per line, each record being 16 hexadecimal digits:
+ *       time (8 digits), event (2), arg8 (2), arg16 (4)
+ * TRACE:END
+ */
+void printTrace()
+{
+    static const char HEX_DIGITS[] = "0123456789abcdef";
+
+    uint32_t head = traceHead.load(std::memory_order_relaxed);
+    uint32_t first = (head > TRACE_SIZE) ? head - TRACE_SIZE : 0;
+
+    console.print("TRACE:BEGIN,count=");
+    console.print(head);
+    console.print(",now=");
+    console.println(micros());
+
+    char line[6 + 8 * 16 + 1];
+    uint8_t length = 0;
+    for (uint32_t i = first; i < head; i++)
+    {
+        const TraceRecord &record = records[i & (TRACE_SIZE - 1)];
+        uint32_t fields[2] = {record.time, (uint32_t)record.event << 24 | (uint32_t)record.arg8 << 16 | record.arg16};
+
+        if (length == 0)
+        {
+            memcpy(line, "TRACE:", 6);
+            length = 6;
+        }
+        for (uint8_t f = 0; f < 2; f++)
+        {
+            for (int8_t shift = 28; shift >= 0; shift -= 4)
+            {
+                line[length++] = HEX_DIGITS[(fields[f] >> shift) & 0xF];
+            }
+        }
+        if (length == sizeof(line) - 1 || i + 1 == head)
+        {
+            line[length] = '\0';
+            console.println(line);
+            length = 0;
+        }
+    }
+    console.println("TRACE:END");
+}
@@ -0,0 +1,159 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file test_main.cpp
+ * @brief Boot and ESP32? handshake sequence checked on the GPIO timeline of the virtual clock.
+ *
+ * setup() and the joystick bring-up run in simulated time, so the 12 seconds of relay steps take a
+ * few milliseconds. The test then checks the exact time of every relay write.
+ */
+
+#include <Arduino.h>
+#include <unity.h>
+#include "hostShim.h"
+#include "bringUp.h"
+#include "controller.h"
+#include "ledStatus.h"
+#include <chrono>
+#include <unistd.h>
+
+void setup();
+
+/// Virtual time at which the frontend sends the handshake, in milliseconds
+static const uint32_t HANDSHAKE_MS = 1000;
+
+/// Time of one joystick in the bring-up, its relays then the settle delay
+static const uint32_t JOYSTICK_MS = BRINGUP_RELAY_DELAY_MS + BRINGUP_SETTLE_DELAY_MS;
+
+/// Serial output of the firmware
+static std::string output;
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+/**
+ * @brief Gives the relay index of a GPIO, -1 if it drives no relay.
+ */
+static int relayIndex(uint8_t pin)
+{
+    for (int relay = 0; relay < 8; relay++)
+    {
+        if (RELAY[relay] == pin)
+        {
+            return relay;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Checks whether a display transfer was recorded at the given time.
+ * @param timeUs Virtual time in microseconds.
+ */
+static bool displayedAt(uint64_t timeUs)
+{
+    for (const HostTimelineEntry &entry : hostTimeline())
+    {
+        if (entry.kind == 'D' && entry.time == timeUs)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Boot then handshake: relays released at boot, then reconnected two by two on schedule.
+ */
+void test_boot_and_handshake()
+{
+    auto start = std::chrono::steady_clock::now();
+    hostSerialInput(HANDSHAKE_MS, (const uint8_t *)"ESP32?\n", 7);
+    setup();
+    hostRunUntil(HANDSHAKE_MS + 4 * JOYSTICK_MS + 100);
+    double wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    uint8_t released = 0;
+    int connected = 0;
+    for (const HostTimelineEntry &entry : hostTimeline())
+    {
+        int relay = (entry.kind == 'G') ? relayIndex(entry.a) : -1;
+        if (relay < 0)
+        {
+            continue;
+        }
+
+        if (entry.b == LOW)
+        {
+            // Every relay is released once, at boot
+            TEST_ASSERT_EQUAL_UINT64(0, entry.time);
+            TEST_ASSERT_FALSE(released & (1 << relay));
+            released |= 1 << relay;
+            continue;
+        }
+
+        // Joystick n: its relay at n * JOYSTICK_MS, the relay of its LEDs BRINGUP_RELAY_DELAY_MS later
+        int joystick = connected / 2;
+        uint64_t expectedMs = HANDSHAKE_MS + joystick * JOYSTICK_MS + (connected % 2) * BRINGUP_RELAY_DELAY_MS;
+        TEST_ASSERT_EQUAL(connected, relay);
+        TEST_ASSERT_EQUAL_UINT64(expectedMs * 1000, entry.time);
+        connected++;
+    }
+    TEST_ASSERT_EQUAL_HEX8(0xff, released);
+    TEST_ASSERT_EQUAL(8, connected);
+
+    // The progress screen of each joystick is sent along with its relay
+    for (int joystick = 0; joystick < 4; joystick++)
+    {
+        TEST_ASSERT_TRUE(displayedAt((uint64_t)(HANDSHAKE_MS + joystick * JOYSTICK_MS) * 1000));
+    }
+
+    TEST_ASSERT_TRUE(output.find("INIT:DONE") != std::string::npos);
+    TEST_ASSERT_EQUAL(STATE_READY, controllerState());
+
+    char message[64];
+    snprintf(message, sizeof(message), "BRINGUP:virtual_ms=%lu,wall_ms=%.1f", millis(), wallMs);
+    TEST_MESSAGE(message);
+    TEST_ASSERT_LESS_THAN(1000.0, wallMs);
+}
+
+int main()
+{
+    hostUseVirtualTime(NULL);
+    hostCaptureSerial(&output);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_boot_and_handshake);
+    int result = UNITY_END();
+
+    // The firmware tasks never return, leave without running the static destructors
+    fflush(stdout);
+    _exit(result);
+}
@@ -0,0 +1,101 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file test_main.cpp
+ * @brief Coalescing of a burst of player count updates, on the virtual clock.
+ *
+ * Once the joysticks are connected, 4 N commands are received in a single chunk. Each one must be
+ * acknowledged in order, but only the last count is rendered, with one frame and one relay write.
+ */
+
+#include <Arduino.h>
+#include <unity.h>
+#include "hostShim.h"
+#include "controller.h"
+#include "ledStatus.h"
+#include "relayBank.h"
+#include "serialReceiver.h"
+#include <unistd.h>
+
+void setup();
+
+/// Virtual time at which the burst is received, once the bring-up is over
+static const uint32_t BURST_MS = 15000;
+
+/// Serial output of the firmware
+static std::string output;
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+/**
+ * @brief A burst of 4 updates gives 4 ACKs, 1 frame, 1 relay write and 3 coalesced commands.
+ */
+void test_burst()
+{
+    hostSerialInput(1000, (const uint8_t *)"ESP32?\n", 7);
+    setup();
+    hostRunUntil(BURST_MS);
+    TEST_ASSERT_EQUAL(STATE_READY, controllerState());
+    TEST_ASSERT_EQUAL_HEX8(0xff, relays.state());
+
+    printRxStats();
+    output.clear();
+    uint32_t frames = display.frameCount() + display.droppedFrames();
+    uint32_t relayWrites = relays.writeCount();
+
+    const char burst[] = "N:3\nN:1\nN:4\nN:2\n";
+    hostSerialInput(BURST_MS, (const uint8_t *)burst, strlen(burst));
+    hostRunUntil(BURST_MS + 100);
+
+    TEST_ASSERT_EQUAL_STRING("ACK:N:3\r\nACK:N:1\r\nACK:N:4\r\nACK:N:2\r\n", output.c_str());
+    TEST_ASSERT_EQUAL_UINT32(1, display.frameCount() + display.droppedFrames() - frames);
+    TEST_ASSERT_EQUAL_UINT32(1, relays.writeCount() - relayWrites);
+    // The bring-up left every relay on, only the LEDs of joysticks 3 and 4 are disconnected
+    TEST_ASSERT_EQUAL_HEX8(0x5f, relays.state());
+
+    output.clear();
+    printRxStats();
+    TEST_ASSERT_TRUE_MESSAGE(output.find(",lines=4,coalesced=3,") != std::string::npos, output.c_str());
+}
+
+int main()
+{
+    hostUseVirtualTime(NULL);
+    hostCaptureSerial(&output);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_burst);
+    int result = UNITY_END();
+
+    // The firmware tasks never return, leave without running the static destructors
+    fflush(stdout);
+    _exit(result);
+}
@@ -0,0 +1,273 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file test_main.cpp
+ * @brief Full coverage test of the controller transition table.
+ *
+ * Every event is fed to the state machine in every state, on the virtual clock. Each transition is
+ * checked against the expected table: whether it is accepted, the next state, the LED pattern and
+ * the action, recognised by the screen it draws in the event trace or by the joystick bring-up it
+ * starts. The time and entry counters printed by STATE? are then compared with the walk.
+ */
+
+#include <Arduino.h>
+#include <unity.h>
+#include "hostShim.h"
+#include "bringUp.h"
+#include "controller.h"
+#include "ledStatus.h"
+#include "trace.h"
+#include <unistd.h>
+#include <vector>
+
+/// Expected action starting the joystick bring-up, the other actions are identified by a TraceScreen
+static const int ACTION_BRINGUP = 0x100;
+
+/// Expected action when nothing is done
+static const int ACTION_NONE = -1;
+
+/**
+ * @brief Expected outcome of an event in a state.
+ */
+struct ExpectedTransition
+{
+    bool accepted;         ///< Whether the event is valid in the state.
+    ControllerState next;  ///< State after the event.
+    int action;            ///< TraceScreen drawn, ACTION_BRINGUP or ACTION_NONE.
+};
+
+/// Expected transitions, indexed by state then event
+static const ExpectedTransition EXPECTED[STATE_COUNT][EV_COUNT] = {
+    // STATE_WAITING
+    {
+        {true, STATE_CONFIG, ACTION_BRINGUP},   // EV_HANDSHAKE
+        {false, STATE_WAITING, ACTION_NONE},    // EV_BRINGUP_DONE
+        {false, STATE_WAITING, ACTION_NONE},    // EV_PLAYERS
+        {true, STATE_WAITING, SCREEN_STARTING}, // EV_STARTING
+        {true, STATE_WAITING, SCREEN_STARTING}, // EV_STARTED
+        {true, STATE_WAITING, SCREEN_STOPPING}, // EV_STOPPING
+        {true, STATE_WAITING, SCREEN_STOPPED},  // EV_STOPPED
+    },
+    // STATE_CONFIG
+    {
+        {true, STATE_CONFIG, ACTION_NONE},      // EV_HANDSHAKE
+        {true, STATE_READY, SCREEN_READY},      // EV_BRINGUP_DONE
+        {false, STATE_CONFIG, ACTION_NONE},     // EV_PLAYERS
+        {false, STATE_CONFIG, ACTION_NONE},     // EV_STARTING
+        {false, STATE_CONFIG, ACTION_NONE},     // EV_STARTED
+        {false, STATE_CONFIG, ACTION_NONE},     // EV_STOPPING
+        {false, STATE_CONFIG, ACTION_NONE},     // EV_STOPPED
+    },
+    // STATE_READY
+    {
+        {true, STATE_CONFIG, ACTION_BRINGUP},   // EV_HANDSHAKE
+        {false, STATE_READY, ACTION_NONE},      // EV_BRINGUP_DONE
+        {true, STATE_READY, SCREEN_JOYSTICK},   // EV_PLAYERS
+        {true, STATE_READY, SCREEN_STARTING},   // EV_STARTING
+        {true, STATE_READY, SCREEN_STARTING},   // EV_STARTED
+        {true, STATE_READY, SCREEN_STOPPING},   // EV_STOPPING
+        {true, STATE_READY, SCREEN_STOPPED},    // EV_STOPPED
+    },
+};
+
+/// Events of the walk, each state is left by its last event once all the others are tried
+static const ControllerEvent WALK[] = {
+    // STATE_WAITING
+    EV_BRINGUP_DONE, EV_PLAYERS, EV_STARTING, EV_STARTED, EV_STOPPING, EV_STOPPED, EV_HANDSHAKE,
+    // STATE_CONFIG
+    EV_HANDSHAKE, EV_PLAYERS, EV_STARTING, EV_STARTED, EV_STOPPING, EV_STOPPED, EV_BRINGUP_DONE,
+    // STATE_READY
+    EV_BRINGUP_DONE, EV_PLAYERS, EV_STARTING, EV_STARTED, EV_STOPPING, EV_STOPPED, EV_HANDSHAKE,
+};
+
+/// LED pattern expected in each state
+static const LedStatus STATE_LEDS[STATE_COUNT] = {WAITING, CONFIG, READY};
+
+/// Serial output of the firmware
+static std::string output;
+
+/// Number of trace records already looked at
+static uint32_t traceCount = 0;
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+/**
+ * @brief Returns the trace records added since the previous call, decoded from the TRACE? dump.
+ */
+static std::vector<TraceRecord> newTraceRecords()
+{
+    output.clear();
+    printTrace();
+
+    uint32_t count = strtoul(output.c_str() + output.find("count=") + 6, NULL, 10);
+    std::vector<TraceRecord> records;
+    size_t line = output.find("\r\n") + 2;
+    while (output.compare(line, 9, "TRACE:END") != 0)
+    {
+        size_t end = output.find("\r\n", line);
+        for (size_t pos = line + 6; pos + 16 <= end; pos += 16)
+        {
+            uint32_t fields = strtoul(output.substr(pos + 8, 8).c_str(), NULL, 16);
+            records.push_back(TraceRecord{(uint32_t)strtoul(output.substr(pos, 8).c_str(), NULL, 16),
+                                          (uint8_t)(fields >> 24), (uint8_t)(fields >> 16), (uint16_t)fields});
+        }
+        line = end + 2;
+    }
+
+    uint32_t added = min(count - traceCount, (uint32_t)records.size());
+    traceCount = count;
+    return std::vector<TraceRecord>(records.end() - added, records.end());
+}
+
+/**
+ * @brief Gives the action recognised in trace records, ACTION_NONE if none.
+ *
+ * @param records The records.
+ * @param startedBringUp Whether the joystick bring-up was started.
+ */
+static int recordedAction(const std::vector<TraceRecord> &records, bool startedBringUp)
+{
+    int action = startedBringUp ? ACTION_BRINGUP : ACTION_NONE;
+    for (const TraceRecord &record : records)
+    {
+        if (record.event == TRACE_SCREEN)
+        {
+            TEST_ASSERT_EQUAL_MESSAGE(ACTION_NONE, action, "more than one action");
+            action = record.arg8;
+        }
+    }
+    return action;
+}
+
+/**
+ * @brief Runs the joystick bring-up to its end on the virtual clock.
+ */
+static void finishBringUp()
+{
+    while (bringUpRunning())
+    {
+        uint32_t wait = serviceBringUp();
+        if (bringUpRunning())
+        {
+            delay(wait);
+        }
+    }
+}
+
+/**
+ * @brief Every event in every state gives the expected transition, and STATE? reports the walk.
+ */
+void test_transitions()
+{
+    bool covered[STATE_COUNT][EV_COUNT] = {};
+    unsigned long expectedTime[STATE_COUNT] = {0, 0, 0};
+    uint32_t expectedEntries[STATE_COUNT] = {1, 0, 0};
+    uint32_t expectedRejected = 0;
+    unsigned long enterTime = 0;
+
+    newTraceRecords();
+    for (size_t i = 0; i < sizeof(WALK) / sizeof(WALK[0]); i++)
+    {
+        ControllerEvent event = WALK[i];
+        ControllerState state = controllerState();
+        const ExpectedTransition &expected = EXPECTED[state][event];
+        char message[64];
+        snprintf(message, sizeof(message), "state %d event %d", state, event);
+
+        // Spend a different time in each step
+        delay(10 + i);
+
+        bool wasRunning = bringUpRunning();
+        TEST_ASSERT_EQUAL_MESSAGE(expected.accepted, controllerAccepts(event), message);
+        TEST_ASSERT_EQUAL_MESSAGE(expected.accepted, controllerDispatch(event, 2), message);
+        flushPlayers();
+        std::vector<TraceRecord> records = newTraceRecords();
+
+        TEST_ASSERT_EQUAL_MESSAGE(expected.next, controllerState(), message);
+        TEST_ASSERT_EQUAL_MESSAGE(STATE_LEDS[expected.next], currentStatus.load(), message);
+        TEST_ASSERT_EQUAL_MESSAGE(expected.action, recordedAction(records, !wasRunning && bringUpRunning()), message);
+        covered[state][event] = true;
+
+        if (!expected.accepted)
+        {
+            expectedRejected++;
+        }
+        else if (expected.next != state)
+        {
+            expectedTime[state] += millis() - enterTime;
+            enterTime = millis();
+            expectedEntries[expected.next]++;
+        }
+
+        if (state == STATE_CONFIG && event == EV_BRINGUP_DONE)
+        {
+            // The bring-up started in STATE_WAITING reports its end once more, rejected in STATE_READY
+            finishBringUp();
+            newTraceRecords();
+            TEST_ASSERT_EQUAL(STATE_READY, controllerState());
+            expectedRejected++;
+        }
+    }
+
+    for (int state = 0; state < STATE_COUNT; state++)
+    {
+        for (int event = 0; event < EV_COUNT; event++)
+        {
+            TEST_ASSERT_TRUE(covered[state][event]);
+        }
+    }
+
+    delay(5);
+    expectedTime[controllerState()] += millis() - enterTime;
+    char expectedStats[128];
+    snprintf(expectedStats, sizeof(expectedStats),
+             "STATE:current=CONFIG,WAITING=%lu/%lu,CONFIG=%lu/%lu,READY=%lu/%lu,rejected=%lu\r\n",
+             expectedTime[STATE_WAITING], (unsigned long)expectedEntries[STATE_WAITING], expectedTime[STATE_CONFIG],
+             (unsigned long)expectedEntries[STATE_CONFIG], expectedTime[STATE_READY],
+             (unsigned long)expectedEntries[STATE_READY], (unsigned long)expectedRejected);
+    output.clear();
+    printStateStats();
+    TEST_ASSERT_EQUAL_STRING(expectedStats, output.c_str());
+}
+
+int main()
+{
+    hostUseVirtualTime(NULL);
+    hostCaptureSerial(&output);
+    display.begin();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_transitions);
+    int result = UNITY_END();
+
+    fflush(stdout);
+    _exit(result);
+}
@@ -0,0 +1,170 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file test_main.cpp
+ * @brief Wakeups and status-change-to-LED latency of the LED status, on the virtual clock.
+ *
+ * The LED status is changed while the firmware runs in simulated time. Each new pattern must start
+ * at the instant of the change, and no task may wake up while the LED blinks, since the pattern
+ * backend plays it on its own.
+ */
+
+#include <Arduino.h>
+#include <unity.h>
+#include "hostShim.h"
+#include "ledStatus.h"
+#include <unistd.h>
+
+void setup();
+
+/// Length of the idle windows, in milliseconds
+static const uint32_t WINDOW_MS = 10000;
+
+/// Serial output of the firmware
+static std::string output;
+
+/// Backend of the status LED in host builds
+static MockLedPatternBackend &ledBackend = static_cast<MockLedPatternBackend &>(ledPatterns);
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+/**
+ * @brief Changes the LED status, then idles for WINDOW_MS.
+ *
+ * The pattern must start at once and the window must cost no wakeup besides the one ending it.
+ *
+ * @param status The new LED status.
+ */
+static void changeAndIdle(LedStatus status)
+{
+    unsigned long changeMs = millis();
+    setLedStatus(status);
+
+    // Status-change-to-LED latency: the pattern starts in the same instant
+    TEST_ASSERT_TRUE(ledBackend.pattern == &LED_PATTERNS[status]);
+    TEST_ASSERT_EQUAL_UINT32(changeMs, ledBackend.startMs);
+    TEST_ASSERT_EQUAL(LED_PATTERNS[status].segments[0].level, ledBackend.level());
+
+    uint32_t wakeups = hostWakeups();
+    hostRunUntil(changeMs + WINDOW_MS);
+    TEST_ASSERT_EQUAL_UINT32(1, hostWakeups() - wakeups);
+
+    // The pattern kept playing without the CPU
+    TEST_ASSERT_EQUAL(ledPatternLevel(LED_PATTERNS[status], WINDOW_MS), ledBackend.level());
+}
+
+/**
+ * @brief Every status starts its pattern at once and blinks without waking any task.
+ */
+void test_status_changes()
+{
+    setup();
+    hostRunUntil(1000);
+    output.clear();
+    printLedStats();
+
+    const LedStatus statuses[] = {WAITING, CONFIG, READY, WAITING, OFF};
+    for (LedStatus status : statuses)
+    {
+        changeAndIdle(status);
+    }
+
+    // LED? reports the changes at 1 per window and the latency, 0 us in virtual time
+    char expected[64];
+    snprintf(expected, sizeof(expected), "LED:changes=5,per_s=%lu,avg=0,max=0\r\n", 1000000UL / WINDOW_MS);
+    output.clear();
+    printLedStats();
+    TEST_ASSERT_EQUAL_STRING(expected, output.c_str());
+}
+
+/**
+ * @brief The WAITING pattern changes level on schedule, 200 ms on then 1000 ms off.
+ */
+void test_waiting_timing()
+{
+    setLedStatus(WAITING);
+    unsigned long startMs = millis();
+    const uint32_t checks[][2] = {{0, HIGH}, {199, HIGH}, {200, LOW}, {1199, LOW}, {1200, HIGH}, {12200, LOW}};
+    for (const uint32_t *check : checks)
+    {
+        delay(startMs + check[0] - millis());
+        TEST_ASSERT_EQUAL(check[1], ledBackend.level());
+    }
+}
+
+/**
+ * @brief Output collecting the printed bytes.
+ */
+class StringPrint : public Print
+{
+public:
+    std::string text; ///< Bytes printed.
+
+    size_t write(uint8_t c) override
+    {
+        text.push_back((char)c);
+        return 1;
+    }
+};
+
+/**
+ * @brief Fades switch level at their middle without PWM, and are marked with '~' in the trace.
+ */
+void test_fade_levels()
+{
+    static const LedSegment segments[] = {{HIGH, 400, true}, {LOW, 800, true}};
+    static const LedPattern breathing = {segments, 2};
+    const uint32_t checks[][2] = {{0, LOW}, {199, LOW}, {200, HIGH}, {599, HIGH}, {800, LOW}, {1400, HIGH}};
+    for (const uint32_t *check : checks)
+    {
+        TEST_ASSERT_EQUAL(check[1], ledPatternLevel(breathing, check[0]));
+    }
+
+    StringPrint trace;
+    printLedPatternTrace("BREATH", breathing, 2000, trace);
+    TEST_ASSERT_EQUAL_STRING("BREATH:0=0,0~1,400~0,1200~1,1600~0\r\n", trace.text.c_str());
+}
+
+int main()
+{
+    hostUseVirtualTime(NULL);
+    hostCaptureSerial(&output);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_status_changes);
+    RUN_TEST(test_waiting_timing);
+    RUN_TEST(test_fade_levels);
+    int result = UNITY_END();
+
+    // The firmware tasks never return, leave without running the static destructors
+    fflush(stdout);
+    _exit(result);
+}
@@ -0,0 +1,297 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file test_main.cpp
+ * @brief Unit test and benchmark of the serial command parser.
+ *
+ * The benchmark feeds a stream of N/L/Q/S commands through the parser and writes their ACK the way
+ * sendAck() does, into a sink discarding the bytes. It reports commands per second and heap
+ * allocations per command, counted by replacing the global operator new.
+ */
+
+#include <Arduino.h>
+#include <unity.h>
+#include "commandParser.h"
+#include <chrono>
+#include <climits>
+#include <cstdlib>
+#include <new>
+
+/// Number of commands fed to the benchmark, a multiple of the 6 commands of the stream
+static const uint32_t BENCH_COMMANDS = 600000;
+
+/// Whether heap allocations are counted
+static bool countAllocations = false;
+
+/// Number of heap allocations while counting
+static uint32_t allocations = 0;
+
+void *operator new(size_t size)
+{
+    if (countAllocations)
+    {
+        allocations++;
+    }
+    void *block = malloc(size ? size : 1);
+    if (block == NULL)
+    {
+        throw std::bad_alloc();
+    }
+    return block;
+}
+
+void operator delete(void *block) noexcept
+{
+    free(block);
+}
+
+void operator delete(void *block, size_t) noexcept
+{
+    free(block);
+}
+
+/**
+ * @brief Output discarding the bytes, standing for Serial in the benchmark.
+ */
+class NullPrint : public Print
+{
+public:
+    uint32_t bytes = 0; ///< Number of bytes written.
+
+    size_t write(uint8_t) override
+    {
+        bytes++;
+        return 1;
+    }
+
+    size_t write(const uint8_t *, size_t size) override
+    {
+        bytes += size;
+        return size;
+    }
+};
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+/**
+ * @brief Pushes a string into the parser.
+ *
+ * @return false if a byte was refused.
+ */
+static bool pushString(CommandParser &parser, const char *str)
+{
+    for (; *str != '\0'; str++)
+    {
+        if (!parser.push(*str))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Lines are trimmed and their value is decoded like String::toInt() did.
+ */
+void test_parse_lines()
+{
+    static CommandParser parser;
+    Command cmd;
+
+    TEST_ASSERT_TRUE(pushString(parser, "  N:3 \r\nESP32?\nQ: -12x\n\nS"));
+    TEST_ASSERT_TRUE(parser.next(cmd));
+    TEST_ASSERT_TRUE(cmd.equals("N:3"));
+    TEST_ASSERT_EQUAL('N', cmd.event);
+    TEST_ASSERT_EQUAL(3, cmd.value);
+    TEST_ASSERT_EQUAL(-1, cmd.seq);
+
+    TEST_ASSERT_TRUE(parser.next(cmd));
+    TEST_ASSERT_TRUE(cmd.equals("ESP32?"));
+
+    TEST_ASSERT_TRUE(parser.next(cmd));
+    TEST_ASSERT_EQUAL('Q', cmd.event);
+    TEST_ASSERT_EQUAL(-12, cmd.value);
+
+    TEST_ASSERT_TRUE(parser.next(cmd));
+    TEST_ASSERT_EQUAL(0, cmd.length);
+    TEST_ASSERT_EQUAL(0, cmd.event);
+
+    // The last line has no newline yet
+    TEST_ASSERT_FALSE(parser.next(cmd));
+    TEST_ASSERT_TRUE(parser.hasPartialLine());
+    TEST_ASSERT_TRUE(parser.push('\n'));
+    TEST_ASSERT_TRUE(parser.next(cmd));
+    TEST_ASSERT_TRUE(cmd.equals("S"));
+    TEST_ASSERT_FALSE(parser.hasPartialLine());
+}
+
+/**
+ * @brief Numbers too large for an int are clamped rather than overflowing.
+ */
+void test_parse_overflow()
+{
+    static CommandParser parser;
+    Command cmd;
+
+    TEST_ASSERT_TRUE(pushString(parser, "N:99999999999\nN:-99999999999\nN:2147483647\nN:2147483648\n"));
+    TEST_ASSERT_TRUE(parser.next(cmd));
+    TEST_ASSERT_EQUAL(INT_MAX, cmd.value);
+    TEST_ASSERT_TRUE(parser.next(cmd));
+    TEST_ASSERT_EQUAL(-INT_MAX, cmd.value);
+    TEST_ASSERT_TRUE(parser.next(cmd));
+    TEST_ASSERT_EQUAL(INT_MAX, cmd.value);
+    TEST_ASSERT_TRUE(parser.next(cmd));
+    TEST_ASSERT_EQUAL(INT_MAX, cmd.value);
+}
+
+/**
+ * @brief Lines wrapping around the end of the ring are returned in one piece.
+ */
+void test_wrap_around()
+{
+    static CommandParser parser;
+    Command cmd;
+    char line[16];
+
+    for (int i = 0; i < 300; i++)
+    {
+        snprintf(line, sizeof(line), "L:%d\n", i);
+        TEST_ASSERT_TRUE(pushString(parser, line));
+        TEST_ASSERT_TRUE(parser.next(cmd));
+        TEST_ASSERT_EQUAL('L', cmd.event);
+        TEST_ASSERT_EQUAL(i, cmd.value);
+        TEST_ASSERT_EQUAL(strlen(line) - 1, cmd.length);
+    }
+}
+
+/**
+ * @brief A line longer than the ring is dropped up to its newline, the next line is kept.
+ */
+void test_overlong_line()
+{
+    static CommandParser parser;
+    Command cmd;
+
+    for (uint16_t i = 0; i < CommandParser::RING_SIZE + 10; i++)
+    {
+        TEST_ASSERT_TRUE(parser.push('x'));
+    }
+    TEST_ASSERT_TRUE(pushString(parser, "\nN:2\n"));
+    TEST_ASSERT_EQUAL_UINT32(1, parser.overflowCount());
+    TEST_ASSERT_TRUE(parser.next(cmd));
+    TEST_ASSERT_TRUE(cmd.equals("N:2"));
+    TEST_ASSERT_FALSE(parser.next(cmd));
+}
+
+/**
+ * @brief Unread complete lines are never dropped: the ring refuses bytes until they are taken out.
+ */
+void test_burst_of_lines()
+{
+    static CommandParser parser;
+    Command cmd;
+    char burst[40 * 6 + 1] = "";
+    for (int i = 0; i < 40; i++)
+    {
+        snprintf(burst + strlen(burst), 7, "N:%d\n", i % 5);
+    }
+
+    int received = 0;
+    for (const char *p = burst; *p != '\0'; p++)
+    {
+        if (!parser.push(*p))
+        {
+            while (parser.next(cmd))
+            {
+                TEST_ASSERT_EQUAL(received++ % 5, cmd.value);
+            }
+            TEST_ASSERT_TRUE(parser.push(*p));
+        }
+    }
+    while (parser.next(cmd))
+    {
+        TEST_ASSERT_EQUAL(received++ % 5, cmd.value);
+    }
+    TEST_ASSERT_EQUAL(40, received);
+    TEST_ASSERT_EQUAL_UINT32(0, parser.overflowCount());
+}
+
+/**
+ * @brief Benchmark: commands per second and heap allocations per command, which must be none.
+ */
+void test_benchmark()
+{
+    static const char *const COMMANDS[] = {"N:2\n", "L:4\n", "Q:1\n", "S\n", "N:3\r\n", "P\n"};
+    static CommandParser parser;
+    NullPrint out;
+    Command cmd;
+    uint32_t handled = 0;
+    int checksum = 0;
+
+    allocations = 0;
+    countAllocations = true;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < BENCH_COMMANDS; i++)
+    {
+        pushString(parser, COMMANDS[i % 6]);
+        while (parser.next(cmd))
+        {
+            out.print("ACK:");
+            out.write((const uint8_t *)cmd.text, cmd.length);
+            out.println();
+            checksum += cmd.value;
+            handled++;
+        }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    countAllocations = false;
+
+    char message[128];
+    snprintf(message, sizeof(message), "PARSER:commands=%lu,commands_per_s=%.0f,allocs_per_command=%.3f",
+             (unsigned long)handled, handled / seconds, (double)allocations / handled);
+    TEST_MESSAGE(message);
+
+    TEST_ASSERT_EQUAL_UINT32(BENCH_COMMANDS, handled);
+    TEST_ASSERT_EQUAL_UINT32(0, allocations);
+    TEST_ASSERT_EQUAL(BENCH_COMMANDS / 6 * 10, checksum);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_parse_lines);
+    RUN_TEST(test_parse_overflow);
+    RUN_TEST(test_wrap_around);
+    RUN_TEST(test_overlong_line);
+    RUN_TEST(test_burst_of_lines);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
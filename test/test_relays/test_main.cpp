@@ -0,0 +1,149 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file test_main.cpp
+ * @brief Write counts and timing of the relay bank, through the mock backend.
+ *
+ * The bank drives a table of relays spread over both GPIO banks, on the virtual clock so the
+ * staggered release takes no time.
+ */
+
+#include <Arduino.h>
+#include <unity.h>
+#include "hostShim.h"
+#include "relayBank.h"
+
+/// Relay GPIOs, relays 4 and 6 on the second GPIO bank
+static const int PINS[8] = {15, 2, 4, 16, 33, 5, 34, 19};
+
+/// Backend recording the writes
+static MockRelayBackend backend;
+
+/// Bank under test
+static RelayBank bank(PINS, 8, backend);
+
+void setUp()
+{
+    backend = MockRelayBackend();
+    bank.begin();
+}
+
+void tearDown()
+{
+}
+
+/**
+ * @brief Gives the bitmask of the relays whose GPIO is HIGH on the mock.
+ */
+static uint8_t mockState()
+{
+    uint8_t state = 0;
+    for (int relay = 0; relay < 8; relay++)
+    {
+        state |= backend.read(PINS[relay]) << relay;
+    }
+    return state;
+}
+
+/**
+ * @brief After begin() every relay is written once, then only the relays that change.
+ */
+void test_apply_diff()
+{
+    bank.apply(0x00);
+    // Both banks are cleared, one clear register each
+    TEST_ASSERT_EQUAL_UINT32(2, backend.registerWrites);
+    TEST_ASSERT_EQUAL_UINT32(2, bank.writeCount());
+
+    bank.apply(0x00);
+    TEST_ASSERT_EQUAL_UINT32(2, backend.registerWrites);
+
+    // Relays 0, 1 and 4 on: one set register per bank
+    bank.apply(0x13);
+    TEST_ASSERT_EQUAL_UINT32(4, backend.registerWrites);
+    TEST_ASSERT_EQUAL_HEX8(0x13, mockState());
+
+    // Relay 1 off and relay 3 on, both on bank 0: one set and one clear register
+    bank.apply(0x19);
+    TEST_ASSERT_EQUAL_UINT32(6, backend.registerWrites);
+    TEST_ASSERT_EQUAL_HEX8(0x19, mockState());
+    TEST_ASSERT_EQUAL_HEX8(0x19, bank.state());
+}
+
+/**
+ * @brief update() and set() leave the other relays untouched, even right after begin().
+ */
+void test_update_masked()
+{
+    backend.level[0] = 0xffffffff;
+    backend.level[1] = 0xffffffff;
+
+    bank.update(0x03, 0x00);
+    TEST_ASSERT_EQUAL_UINT32(1, backend.registerWrites);
+    TEST_ASSERT_EQUAL_HEX8(0xfc, mockState());
+
+    bank.set(6, false);
+    TEST_ASSERT_EQUAL_UINT32(2, backend.registerWrites);
+    TEST_ASSERT_EQUAL_HEX8(0xbc, mockState());
+
+    // Known relays already in the requested state are not written again
+    bank.update(0x43, 0x00);
+    TEST_ASSERT_EQUAL_UINT32(2, backend.registerWrites);
+}
+
+/**
+ * @brief The staggered release of disconnectAllRelays() writes each pair 500 ms after the previous one.
+ */
+void test_staggered_release()
+{
+    backend.level[0] = 0xffffffff;
+    backend.level[1] = 0xffffffff;
+
+    unsigned long start = micros();
+    for (int relay = 0; relay < 8; relay += 2)
+    {
+        uint32_t writes = backend.registerWrites;
+        bank.update(3 << relay, 0);
+        TEST_ASSERT_EQUAL_UINT32(start + relay / 2 * 500000UL, backend.lastWriteUs);
+        // The last two pairs each have a relay on the second GPIO bank
+        TEST_ASSERT_EQUAL_UINT32((relay >= 4) ? 2 : 1, backend.registerWrites - writes);
+        // The relays of the next pairs are not written yet
+        TEST_ASSERT_EQUAL_HEX8((0xff << (relay + 2)) & 0xff, mockState());
+        delay(500);
+    }
+    TEST_ASSERT_EQUAL_UINT32(6, backend.registerWrites);
+    TEST_ASSERT_EQUAL_HEX8(0x00, mockState());
+}
+
+int main()
+{
+    hostUseVirtualTime(NULL);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_apply_diff);
+    RUN_TEST(test_update_masked);
+    RUN_TEST(test_staggered_release);
+    return UNITY_END();
+}
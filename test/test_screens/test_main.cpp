@@ -0,0 +1,258 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file test_main.cpp
+ * @brief Golden image regression test of the screens of bitmapManager.cpp.
+ *
+ * Every screen is rendered into the emulated SSD1306 and its display RAM is compared pixel by pixel
+ * with the PBM image checked in under test/golden. The same images are expected from the full frame
+ * buffer build (pio test -e native) and from the page buffer build (pio test -e nativePage).
+ *
+ * After an intended rendering change, regenerate the images with
+ *   .pio/build/native/program --screens test/golden 1
+ * and review them before committing.
+ *
+ * A benchmark then compares, for every bitmap stored as page format tiles, the time to draw it with
+ * the XBM path of the host U8g2 shim and with the tile blit of CustomDisplay::drawAsset(). The
+ * baseline is the shim drawXBMP(), not the one of the U8g2 library, so the ratio only shows the order
+ * of magnitude saved on the target.
+ */
+
+#include <Arduino.h>
+#include <unity.h>
+#include "assets.h"
+#include "bitmapManager.h"
+#include "ledStatus.h"
+#include <chrono>
+#include <string>
+
+/// Size of a 128x64 binary PBM image without its header
+static const size_t PBM_SIZE = 128 / 8 * 64;
+
+/// Number of timed draws of each bitmap in the blit benchmark
+static const uint32_t BLIT_RUNS = 2000;
+
+/**
+ * @brief Screen compared with its golden image.
+ */
+struct GoldenScreen
+{
+    const char *name;    ///< Name of the screen, also the name of its PBM file.
+    LedStatus status;    ///< Status selecting the star variant.
+    void (*render)();    ///< Draws the screen and sends it to the display.
+};
+
+/// Screens in the order of program --screens, each one is drawn over the previous one
+static const GoldenScreen SCREENS[] = {
+    {"loading", CONFIG, drawLoadingScreen},
+    {"waiting", WAITING, waitingScreen},
+    {"ready", READY, readyScreen},
+    {"starting", READY, startingScreen},
+    {"stopping", READY, stoppingScreen},
+    {"stopped", READY, stoppedScreen},
+    {"joystick0", READY, []() { joystickScreen(0); }},
+    {"joystick1", READY, []() { joystickScreen(1); }},
+    {"joystick2", READY, []() { joystickScreen(2); }},
+    {"joystick3", READY, []() { joystickScreen(3); }},
+    {"joystick4", READY, []() { joystickScreen(4); }},
+    {"progress25", CONFIG, []() { progressScreen(25); }},
+    {"progress50", CONFIG, []() { progressScreen(50); }},
+    {"progress75", CONFIG, []() { progressScreen(75); }},
+    {"progress100", CONFIG, []() { progressScreen(100); }},
+};
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+/**
+ * @brief Gives the path of a golden image, test/golden next to the directory of this test.
+ * @param name Name of the screen.
+ */
+static std::string goldenPath(const char *name)
+{
+    std::string path = __FILE__;
+    path.erase(path.find_last_of('/') + 1);
+    return path + "../golden/" + name + ".pbm";
+}
+
+/**
+ * @brief Reads the pixels of a 128x64 binary PBM image.
+ *
+ * @param path Path of the image.
+ * @param pixels Filled with the rows of the image, 16 bytes per row, leftmost pixel in the MSB.
+ * @return true if the image was read.
+ */
+static bool readPbm(const std::string &path, uint8_t *pixels)
+{
+    FILE *file = fopen(path.c_str(), "rb");
+    if (file == NULL)
+    {
+        return false;
+    }
+    char header[10];
+    bool ok = fread(header, 1, sizeof(header), file) == sizeof(header) &&
+              memcmp(header, "P4\n128 64\n", sizeof(header)) == 0 && fread(pixels, 1, PBM_SIZE, file) == PBM_SIZE;
+    fclose(file);
+    return ok;
+}
+
+/**
+ * @brief Compares the display RAM of the emulated SSD1306 with a golden image.
+ *
+ * @param name Name of the screen, for the failure message.
+ * @param golden Pixels of the golden image.
+ */
+static void assertFrameMatches(const char *name, const uint8_t *golden)
+{
+    const uint8_t *frame = display.getU8x8()->gddram;
+    uint32_t differences = 0;
+    int firstX = -1;
+    int firstY = -1;
+    for (int y = 0; y < 64; y++)
+    {
+        for (int x = 0; x < 128; x++)
+        {
+            bool expected = golden[y * 16 + x / 8] & (0x80 >> (x % 8));
+            bool actual = frame[(y / 8) * 128 + x] & (1 << (y % 8));
+            if (expected != actual)
+            {
+                if (differences++ == 0)
+                {
+                    firstX = x;
+                    firstY = y;
+                }
+            }
+        }
+    }
+
+    char message[96];
+    snprintf(message, sizeof(message), "%s: %lu pixels differ, first at %d,%d", name, (unsigned long)differences,
+             firstX, firstY);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, differences, message);
+}
+
+/**
+ * @brief Every screen matches its golden image, drawn over the previous screen and from scratch.
+ */
+void test_golden_screens()
+{
+    static uint8_t golden[PBM_SIZE];
+    const GoldenScreen *previous = &SCREENS[0];
+    for (const GoldenScreen &screen : SCREENS)
+    {
+        std::string path = goldenPath(screen.name);
+        TEST_ASSERT_TRUE_MESSAGE(readPbm(path, golden), path.c_str());
+
+        setLedStatus(previous->status);
+        previous->render();
+        setLedStatus(screen.status);
+        screen.render();
+        assertFrameMatches(screen.name, golden);
+        previous = &screen;
+
+        display.invalidate();
+        invalidateScreen();
+        screen.render();
+        assertFrameMatches(screen.name, golden);
+    }
+}
+
+/**
+ * @brief Times a draw call over BLIT_RUNS runs on a cleared buffer.
+ * @return The average time of a draw in nanoseconds.
+ */
+template <typename Draw>
+static double timeDraw(Draw draw)
+{
+    display.clearBuffer();
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t run = 0; run < BLIT_RUNS; run++)
+    {
+        draw();
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / BLIT_RUNS;
+}
+
+/**
+ * @brief Benchmark: drawXBMP() of the U8g2 shim against the page format blit, same pixels expected.
+ */
+void test_blit_benchmark()
+{
+    static uint8_t xbm[128 / 8 * 64];
+    static uint8_t expected[CustomDisplay::FRAME_SIZE];
+    uint16_t bufferSize = display.getBufferTileWidth() * 8 * display.getBufferTileHeight();
+    uint8_t benched = 0;
+
+    for (uint8_t i = 0; i < ASSET_COUNT; i++)
+    {
+        const PackedAsset &asset = *ALL_ASSETS[i];
+        if (asset.format != ASSET_TILES)
+        {
+            continue;
+        }
+        unpackAssetXbm(asset, xbm);
+
+        double xbmNs = timeDraw([&]() { display.DisplayBase::drawXBMP(0, 0, asset.width, asset.height, xbm); });
+        memcpy(expected, display.getBufferPtr(), bufferSize);
+        double blitNs = timeDraw([&]() { display.drawAsset(0, 0, asset); });
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(expected, display.getBufferPtr(), bufferSize, ASSET_NAMES[i]);
+
+        char message[128];
+        snprintf(message, sizeof(message), "BLIT:%s:%ux%u,shim_xbm_ns=%.0f,page_blit_ns=%.0f,ratio=%.1f",
+                 ASSET_NAMES[i], asset.width, asset.height, xbmNs, blitNs, xbmNs / blitNs);
+        TEST_MESSAGE(message);
+        benched++;
+    }
+    TEST_ASSERT_GREATER_THAN(0, benched);
+}
+
+/**
+ * @brief A tiles asset at a y off a page boundary is rejected rather than drawn on the wrong rows.
+ */
+void test_unaligned_tiles()
+{
+    uint16_t bufferSize = display.getBufferTileWidth() * 8 * display.getBufferTileHeight();
+    static uint8_t blank[CustomDisplay::FRAME_SIZE];
+
+    display.clearBuffer();
+    display.drawAsset(0, 4, JoyONJ1On);
+    TEST_ASSERT_EQUAL_MEMORY(blank, display.getBufferPtr(), bufferSize);
+}
+
+int main()
+{
+    display.begin();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_golden_screens);
+    RUN_TEST(test_blit_benchmark);
+    RUN_TEST(test_unaligned_tiles);
+    return UNITY_END();
+}
@@ -0,0 +1,91 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file test_main.cpp
+ * @brief Smoke test of the native build: the firmware sources link under the Unity runner and boot.
+ *
+ * Runs setup() on the virtual clock of hostShim.h, then answers the ESP32? handshake.
+ */
+
+#include <Arduino.h>
+#include <unity.h>
+#include "hostShim.h"
+#include "controller.h"
+#include "ledStatus.h"
+#include <unistd.h>
+
+void setup();
+
+/// Serial output of the firmware
+static std::string output;
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+/**
+ * @brief The firmware boots and waits for the frontend.
+ */
+void test_boot()
+{
+    setup();
+
+    TEST_ASSERT_TRUE(output.find("ESP32 ready to receive messages...") != std::string::npos);
+    TEST_ASSERT_EQUAL(STATE_WAITING, controllerState());
+    TEST_ASSERT_EQUAL(WAITING, currentStatus.load());
+}
+
+/**
+ * @brief The handshake is answered and starts the joystick bring-up.
+ */
+void test_handshake()
+{
+    uint32_t now = millis();
+    hostSerialInput(now, (const uint8_t *)"ESP32?\n", 7);
+    hostRunUntil(now + 100);
+
+    TEST_ASSERT_TRUE(output.find("ESP32 ready\r\n") != std::string::npos);
+    TEST_ASSERT_EQUAL(STATE_CONFIG, controllerState());
+    TEST_ASSERT_EQUAL(CONFIG, currentStatus.load());
+}
+
+int main()
+{
+    hostUseVirtualTime(NULL);
+    hostCaptureSerial(&output);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_boot);
+    RUN_TEST(test_handshake);
+    int result = UNITY_END();
+
+    // The firmware tasks never return, leave without running the static destructors
+    fflush(stdout);
+    _exit(result);
+}
@@ -0,0 +1,144 @@
+/***************************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2024 Daboule, Azway Retro
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ****************************************************************************************/
+
+/**
+ * @file test_main.cpp
+ * @brief Stress test and throughput benchmark of the lock-free SPSC queue.
+ *
+ * A producer thread and a consumer thread exchange a sequence of numbered items through a small
+ * queue, so it is full or empty most of the time. Both yield the CPU while waiting, so the test also
+ * runs on a single core host. The consumer checks that every item arrives once,
+ * in order and not torn. The throughput is reported as items per second.
+ */
+
+#include <Arduino.h>
+#include <unity.h>
+#include "spscQueue.h"
+#include <chrono>
+#include <thread>
+
+/// Number of items sent through the queue by the stress test
+static const uint32_t STRESS_ITEMS = 1000000;
+
+/**
+ * @brief Item checked for tearing, check is always the complement of seq.
+ */
+struct Item
+{
+    uint32_t seq;   ///< Position of the item in the sequence.
+    uint32_t check; ///< ~seq.
+};
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+/**
+ * @brief Full and empty queues refuse push() and pop(), and the indexes wrap around the ring.
+ */
+void test_full_and_empty()
+{
+    SpscQueue<int, 4> queue;
+    int value = 0;
+
+    TEST_ASSERT_TRUE(queue.empty());
+    TEST_ASSERT_FALSE(queue.pop(value));
+    for (int round = 0; round < 3; round++)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            TEST_ASSERT_TRUE(queue.push(round * 4 + i));
+        }
+        TEST_ASSERT_FALSE(queue.push(-1));
+        TEST_ASSERT_EQUAL(4, queue.size());
+        for (int i = 0; i < 4; i++)
+        {
+            TEST_ASSERT_TRUE(queue.pop(value));
+            TEST_ASSERT_EQUAL(round * 4 + i, value);
+        }
+        TEST_ASSERT_FALSE(queue.pop(value));
+    }
+}
+
+/**
+ * @brief Two threads exchange STRESS_ITEMS items without loss, duplicate, reordering or tearing.
+ */
+void test_two_threads()
+{
+    static SpscQueue<Item, 16> queue;
+    uint32_t fullSpins = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    std::thread producer([&fullSpins]()
+                         {
+                             for (uint32_t seq = 0; seq < STRESS_ITEMS; seq++)
+                             {
+                                 while (!queue.push(Item{seq, ~seq}))
+                                 {
+                                     fullSpins++;
+                                     std::this_thread::yield();
+                                 }
+                             }
+                         });
+
+    uint32_t expected = 0;
+    uint32_t errors = 0;
+    Item item;
+    while (expected < STRESS_ITEMS)
+    {
+        if (!queue.pop(item))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        if (item.seq != expected || item.check != ~expected)
+        {
+            errors++;
+        }
+        expected++;
+    }
+    producer.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    char message[128];
+    snprintf(message, sizeof(message), "SPSC:items=%lu,items_per_s=%.0f,full_spins=%lu", (unsigned long)STRESS_ITEMS,
+             STRESS_ITEMS / seconds, (unsigned long)fullSpins);
+    TEST_MESSAGE(message);
+
+    TEST_ASSERT_EQUAL(0, errors);
+    TEST_ASSERT_TRUE(queue.empty());
+    TEST_ASSERT_FALSE(queue.pop(item));
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_full_and_empty);
+    RUN_TEST(test_two_threads);
+    return UNITY_END();
+}
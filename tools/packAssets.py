@@ -0,0 +1,363 @@
+"""
+Asset pipeline packing the PNG bitmaps of assets/ into one aligned blob.
+
+assets/assets.txt lists the bitmaps with their format and size, each read from assets/<name>.png.
+The script writes include/assets.h and src/assets.cpp, only when their content changes. See
+include/assetStore.h for the layout of the blob:
+- the 8x8 tiles of the "tiles" bitmaps come first, in SSD1306 page format (one byte per column, top
+  pixel in the least significant bit), each distinct tile stored once,
+- each "tiles" bitmap is then a map of tile numbers, drawn at a page aligned y by copying the tiles,
+- each "xbm" bitmap is run length encoded XBM rows, drawn at any position,
+- every bitmap starts on an ASSET_ALIGN boundary, identical bitmaps sharing their bytes,
+- the bitmaps whose name appears in no source of src/, include/ or host/ are dropped.
+The build stops when a PNG does not have the size given in assets.txt, or when a "tiles" bitmap is
+not made of whole tiles.
+
+Usage: python tools/packAssets.py
+It also runs automatically before each PlatformIO build (extra_scripts in platformio.ini) and prints
+the flash used by the assets.
+"""
+
+import os
+import re
+import struct
+import zlib
+
+# Alignment of the bitmaps in the blob, in bytes, and of the tiles (their size)
+ASSET_ALIGN = 4
+TILE_SIZE = 8
+
+# Directories searched for references to the assets, and generated files to ignore there
+SOURCE_DIRS = ["src", "include", "host"]
+GENERATED = ["assets.h", "assets.cpp"]
+
+FORMATS = {"xbm": "ASSET_XBM", "tiles": "ASSET_TILES"}
+
+try:
+    Import("env")  # noqa: F821 (defined when run by PlatformIO)
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+ASSETS_DIR = os.path.join(PROJECT_DIR, "assets")
+
+HEADER = """{license}
+/**
+ * @file {name}
+ * @brief Bitmaps of the firmware, packed in one aligned blob.
+ *
+ * Generated by tools/packAssets.py from assets/assets.txt and the PNG files of assets/, do not edit.
+ * Only the bitmaps referenced by the sources are kept. See assetStore.h for the format.
+ */
+"""
+
+
+class AssetError(Exception):
+    pass
+
+
+def read_license():
+    """Returns the license banner at the top of assetStore.h."""
+    with open(os.path.join(PROJECT_DIR, "include", "assetStore.h")) as f:
+        source = f.read()
+    return source[:source.index("*/") + 2] + "\n"
+
+
+def read_manifest():
+    """Returns the (name, format, width, height) of each line of assets.txt."""
+    entries = []
+    with open(os.path.join(ASSETS_DIR, "assets.txt")) as f:
+        for number, line in enumerate(f, 1):
+            line = line.split("#")[0].strip()
+            if not line:
+                continue
+            m = re.match(r"(\w+)\s+(\w+)\s+(\d+)x(\d+)$", line)
+            if not m or m.group(2) not in FORMATS:
+                raise AssetError("assets.txt:%d: expected <name> xbm|tiles <width>x<height>" % number)
+            entries.append((m.group(1), m.group(2), int(m.group(3)), int(m.group(4))))
+    return entries
+
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+def read_png(path):
+    """Returns (width, height, pixels) of a non interlaced PNG, pixels being rows of booleans, True when lit.
+
+    A pixel is lit when its luminance is at least half the maximum and it is not transparent.
+    """
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise AssetError("%s is not a PNG file" % path)
+    pos = 8
+    idat = b""
+    palette = []
+    header = None
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += length + 12
+        if kind == b"IHDR":
+            header = struct.unpack(">IIBBBBB", body)
+        elif kind == b"PLTE":
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+    width, height, depth, color, _, _, interlace = header
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}.get(color)
+    if channels is None or depth == 16 or interlace:
+        raise AssetError("%s: only 1 to 8 bit, non interlaced PNG files are supported" % path)
+
+    raw = zlib.decompress(idat)
+    stride = (width * channels * depth + 7) // 8
+    step = max(1, channels * depth // 8)
+    maximum = (1 << depth) - 1
+    rows = []
+    previous = bytearray(stride)
+    pos = 0
+    for _ in range(height):
+        kind = raw[pos]
+        line = bytearray(raw[pos + 1:pos + 1 + stride])
+        pos += stride + 1
+        for i in range(stride):
+            left = line[i - step] if i >= step else 0
+            up = previous[i]
+            corner = previous[i - step] if i >= step else 0
+            if kind == 1:
+                line[i] = (line[i] + left) & 0xFF
+            elif kind == 2:
+                line[i] = (line[i] + up) & 0xFF
+            elif kind == 3:
+                line[i] = (line[i] + (left + up) // 2) & 0xFF
+            elif kind == 4:
+                line[i] = (line[i] + paeth(left, up, corner)) & 0xFF
+        previous = line
+
+        samples = []
+        for byte in line:
+            for shift in range(8 - depth, -1, -depth):
+                samples.append((byte >> shift) & maximum)
+        row = []
+        for x in range(width):
+            sample = samples[x * channels:(x + 1) * channels]
+            if color == 3:
+                red, green, blue = palette[sample[0]]
+                lit = red + green + blue >= 3 * 128
+            else:
+                lit = sum(sample[:min(3, channels)]) * 2 >= maximum * min(3, channels)
+                if color in (4, 6):
+                    lit = lit and sample[-1] * 2 >= maximum
+            row.append(lit)
+        rows.append(row)
+    return width, height, rows
+
+
+# A string or character literal, kept, or a comment, dropped
+TOKEN_OR_COMMENT = re.compile(r'"(?:\\.|[^"\\\n])*"|\'(?:\\.|[^\'\\\n])*\'|//[^\n]*|/\*.*?\*/', re.DOTALL)
+
+
+def strip_comments(source):
+    """Returns C++ source with its comments replaced by spaces, string literals untouched."""
+    return TOKEN_OR_COMMENT.sub(lambda m: " " if m.group(0).startswith("/") else m.group(0), source)
+
+
+def referenced_names():
+    """Returns the identifiers used by the code of the firmware and of the host build, comments excluded."""
+    names = set()
+    for directory in SOURCE_DIRS:
+        for root, _, files in os.walk(os.path.join(PROJECT_DIR, directory)):
+            for name in files:
+                if name in GENERATED or not name.endswith((".cpp", ".h")):
+                    continue
+                with open(os.path.join(root, name), errors="replace") as f:
+                    names.update(re.findall(r"\w+", strip_comments(f.read())))
+    return names
+
+
+def to_xbm(pixels, width, height):
+    """Returns the XBM rows of a bitmap, leftmost pixel in the least significant bit."""
+    out = []
+    for y in range(height):
+        for x in range(0, width, 8):
+            out.append(sum(1 << bit for bit in range(8) if x + bit < width and pixels[y][x + bit]))
+    return out
+
+
+def to_tiles(pixels, width, height):
+    """Returns the 8x8 tiles of a bitmap, row by row, each tile being 8 column bytes."""
+    tiles = []
+    for top in range(0, height, 8):
+        for left in range(0, width, 8):
+            tiles.append(bytes(sum(1 << bit for bit in range(8) if pixels[top + bit][left + x])
+                               for x in range(8)))
+    return tiles
+
+
+def rle_encode(data):
+    """Run length encodes bytes: 0x00-0x7f copy n+1 literal bytes, 0x80-0xff repeat a byte (n & 0x7f)+2 times."""
+    out = []
+    literal = []
+
+    def flush():
+        while literal:
+            chunk = literal[:128]
+            del literal[:128]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and data[i + run] == data[i] and run < 129:
+            run += 1
+        if run >= 3:
+            flush()
+            out.extend([0x80 | (run - 2), data[i]])
+            i += run
+        else:
+            literal.append(data[i])
+            i += 1
+    flush()
+    return out
+
+
+def rle_decode(data, size):
+    """Decodes run length encoded bytes, to check the encoder."""
+    out = []
+    i = 0
+    while len(out) < size:
+        control = data[i]
+        if control & 0x80:
+            out.extend([data[i + 1]] * ((control & 0x7F) + 2))
+            i += 2
+        else:
+            out.extend(data[i + 1:i + 2 + control])
+            i += control + 2
+    return out
+
+
+def format_bytes(data):
+    """Formats bytes 16 per line."""
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("\t" + ", ".join("0x%02x" % v for v in data[i:i + 16]))
+    return ",\n".join(lines)
+
+
+def write_if_changed(path, content):
+    """Writes a file only if its content changes, so the build is not triggered for nothing."""
+    if os.path.exists(path):
+        with open(path) as f:
+            if f.read() == content:
+                return
+    with open(path, "w") as f:
+        f.write(content)
+    print("packAssets: generated " + os.path.relpath(path, PROJECT_DIR))
+
+
+def pack(entries, used):
+    """Returns the blob, the tile count and the (name, format, width, height, offset, size, raw) of the kept bitmaps."""
+    tiles = []
+    tile_numbers = {}
+    encoded = []
+    for name, fmt, width, height in entries:
+        if name not in used:
+            continue
+        path = os.path.join(ASSETS_DIR, name + ".png")
+        png_width, png_height, pixels = read_png(path)
+        if (png_width, png_height) != (width, height):
+            raise AssetError("%s is %dx%d, assets.txt declares %dx%d" % (path, png_width, png_height, width, height))
+        if width > 255 or height > 255:
+            raise AssetError("%s: bitmaps are limited to 255x255" % name)
+        if fmt == "tiles":
+            if width % 8 or height % 8:
+                raise AssetError("%s: a tiles bitmap must be a multiple of 8 pixels wide and high" % name)
+            data = []
+            for tile in to_tiles(pixels, width, height):
+                if tile not in tile_numbers:
+                    tile_numbers[tile] = len(tiles)
+                    tiles.append(tile)
+                data.append(tile_numbers[tile])
+            raw = width * height // 8
+        else:
+            rows = to_xbm(pixels, width, height)
+            data = rle_encode(rows)
+            if rle_decode(data, len(rows)) != rows:
+                raise AssetError("%s does not survive the encoding" % name)
+            raw = len(rows)
+        encoded.append((name, fmt, width, height, data, raw))
+    if len(tiles) > 256:
+        raise AssetError("%d distinct tiles, the tile maps hold up to 256" % len(tiles))
+
+    blob = [byte for tile in tiles for byte in tile]
+    offsets = {}
+    kept = []
+    for name, fmt, width, height, data, raw in encoded:
+        key = (fmt, tuple(data))
+        if key not in offsets:
+            blob.extend([0] * (-len(blob) % ASSET_ALIGN))
+            offsets[key] = len(blob)
+            blob.extend(data)
+        kept.append((name, fmt, width, height, offsets[key], len(data), raw))
+    if len(blob) > 0xFFFF:
+        raise AssetError("the blob is %d bytes, offsets are limited to 16 bits" % len(blob))
+    return blob, len(tiles), kept
+
+
+def main():
+    entries = read_manifest()
+    used = referenced_names()
+    blob, tile_count, kept = pack(entries, used)
+    dropped = [name for name, _, _, _ in entries if name not in used]
+    raw_total = sum(asset[6] for asset in kept)
+
+    license = read_license()
+    header = [HEADER.format(license=license, name="assets.h"), "#ifndef ASSETS_H", "#define ASSETS_H", "",
+              '#include "assetStore.h"', "",
+              "/** @brief Number of distinct 8x8 tiles at the start of ASSET_BLOB. */",
+              "#define ASSET_TILE_COUNT %d" % tile_count, "",
+              "/** @brief Size of ASSET_BLOB in bytes. */",
+              "#define ASSET_BLOB_SIZE %d" % len(blob), ""]
+    for name, fmt, width, height, offset, size, raw in kept:
+        header.append("// '%s', %dx%dpx, %s, %d bytes from %d" % (name, width, height, fmt, size, raw))
+        header.append("constexpr PackedAsset %s = {%d, %d, %d, %s};" % (name, width, height, offset, FORMATS[fmt]))
+        header.append("")
+    header.append("/** @brief Number of packed assets. */")
+    header.append("#define ASSET_COUNT %d" % len(kept))
+    header.append("")
+    header.append("/** @brief All packed assets, to benchmark them. */")
+    header.append("extern const PackedAsset *const ALL_ASSETS[ASSET_COUNT];")
+    header.append("")
+    header.append("/** @brief Names of the packed assets, same order as ALL_ASSETS. */")
+    header.append("extern const char *const ASSET_NAMES[ASSET_COUNT];")
+    header.append("")
+    header.append("#endif // ASSETS_H")
+
+    body = [HEADER.format(license=license, name="assets.cpp"), '#include "assets.h"', "",
+            "// %d bytes: %d tiles, then the bitmaps, packed from %d bytes. Unreferenced: %s"
+            % (len(blob), tile_count, raw_total, ", ".join(dropped) or "none"),
+            "alignas(%d) const uint8_t ASSET_BLOB[ASSET_BLOB_SIZE] PROGMEM = {" % TILE_SIZE,
+            format_bytes(blob) + "};", "",
+            "const PackedAsset *const ALL_ASSETS[ASSET_COUNT] = {",
+            ",\n".join("\t&%s" % asset[0] for asset in kept) + "};", "",
+            "const char *const ASSET_NAMES[ASSET_COUNT] = {",
+            ",\n".join('\t"%s"' % asset[0] for asset in kept) + "};"]
+
+    write_if_changed(os.path.join(PROJECT_DIR, "include", "assets.h"), "\n".join(header) + "\n")
+    write_if_changed(os.path.join(PROJECT_DIR, "src", "assets.cpp"), "\n".join(body) + "\n")
+    print("packAssets: %d assets, %d bytes packed from %d, %d distinct tiles, %d unreferenced dropped"
+          % (len(kept), len(blob), raw_total, tile_count, len(dropped)))
+
+
+try:
+    main()
+except AssetError as error:
+    raise SystemExit("packAssets: error: %s" % error)
@@ -0,0 +1,242 @@
+"""
+Host side of the serial protocols of the firmware, with a round trip benchmark.
+
+The firmware speaks the text protocol (one command per line, ACK:<command> answers) and, after
+the ESP32?BIN handshake, the binary protocol described in include/binaryProtocol.h: COBS framed
+packets holding a sequence number, an opcode, a payload and a CRC16. In binary mode the commands
+can be pipelined, the acknowledgements being matched by sequence number.
+
+Usage:
+  python tools/serialClient.py --port /dev/ttyUSB0 bench [--count 200] [--window 8]
+  python tools/serialClient.py --exec ".pio/build/native/program 1000" bench
+
+--exec runs the native build (pio run -e native) and talks to it through its standard input and
+output, which gives a loopback without hardware. --port needs pyserial.
+The bench handshakes, waits for the joysticks bring-up (INIT:DONE), then sends the same command
+(P by default) in text mode one at a time, and in binary mode one at a time then pipelined, and
+prints the round trip latency and the throughput of each run.
+"""
+
+import argparse
+import shlex
+import struct
+import subprocess
+import sys
+import threading
+import time
+
+OP_TEXT = 0x01
+OP_ACK = 0x06
+ACK_OK = 0
+
+
+def crc16(data, crc=0xFFFF):
+    """CRC-16/CCITT-FALSE, same as crc16() of the firmware."""
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def cobs_encode(data):
+    out = bytearray([0])
+    code = 0
+    for byte in data:
+        if byte == 0:
+            out[code] = len(out) - code
+            code = len(out)
+            out.append(0)
+        else:
+            out.append(byte)
+    out[code] = len(out) - code
+    return bytes(out)
+
+
+def cobs_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        if code == 0 or i + code > len(data):
+            return None
+        out += data[i + 1:i + code]
+        i += code
+        if code < 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def encode_packet(seq, opcode, payload=b""):
+    raw = bytes([seq & 0xFF, opcode]) + payload
+    return cobs_encode(raw + struct.pack(">H", crc16(raw))) + b"\x00"
+
+
+def encode_command(seq, command):
+    """Packet of a text command: event letter opcode and value payload when it has a ':' value."""
+    if len(command) == 1:
+        return encode_packet(seq, ord(command))
+    if len(command) > 2 and command[1] == ":" and command[2:].lstrip("-").isdigit():
+        return encode_packet(seq, ord(command[0]), struct.pack("<i", int(command[2:])))
+    return encode_packet(seq, OP_TEXT, command.encode())
+
+
+class Link:
+    """Byte stream to the firmware, a serial port or the native program."""
+
+    def __init__(self, port=None, command=None):
+        self.buffer = bytearray()
+        self.lock = threading.Condition()
+        if command:
+            self.process = subprocess.Popen(shlex.split(command), stdin=subprocess.PIPE, stdout=subprocess.PIPE)
+            self.send = self._send_process
+            reader = self.process.stdout.read1
+        else:
+            import serial  # pyserial
+
+            self.serial = serial.Serial(port, 115200, timeout=0.1)
+            self.send = self.serial.write
+            reader = lambda size: self.serial.read(max(1, self.serial.in_waiting))  # noqa: E731
+        threading.Thread(target=self._read, args=(reader,), daemon=True).start()
+
+    def _send_process(self, data):
+        self.process.stdin.write(data)
+        self.process.stdin.flush()
+
+    def _read(self, reader):
+        while True:
+            data = reader(4096)
+            if not data:
+                time.sleep(0.001)
+                continue
+            with self.lock:
+                self.buffer += data
+                self.lock.notify_all()
+
+    def take_until(self, delimiter, timeout=20.0):
+        """Returns the bytes up to the delimiter (excluded), None on timeout."""
+        deadline = time.monotonic() + timeout
+        with self.lock:
+            while delimiter not in self.buffer:
+                remaining = deadline - time.monotonic()
+                if remaining <= 0:
+                    return None
+                self.lock.wait(remaining)
+            index = self.buffer.index(delimiter)
+            data = bytes(self.buffer[:index])
+            del self.buffer[:index + len(delimiter)]
+            return data
+
+
+def read_line(link, timeout=20.0):
+    line = link.take_until(b"\n", timeout)
+    return None if line is None else line.decode(errors="replace").strip()
+
+
+def read_packet(link, timeout=20.0):
+    """Next valid packet as (seq, opcode, payload), skipping corrupted frames."""
+    while True:
+        frame = link.take_until(b"\x00", timeout)
+        if frame is None:
+            return None
+        raw = cobs_decode(frame)
+        if raw is None or len(raw) < 4 or crc16(raw[:-2]) != struct.unpack(">H", raw[-2:])[0]:
+            continue
+        return raw[0], raw[1], raw[2:-2]
+
+
+def wait_text(link, expected, timeout=30.0):
+    deadline = time.monotonic() + timeout
+    while time.monotonic() < deadline:
+        line = read_line(link, deadline - time.monotonic())
+        if line is not None and line.startswith(expected):
+            return line
+    sys.exit("timeout waiting for " + expected)
+
+
+def wait_binary_text(link, expected, timeout=30.0):
+    deadline = time.monotonic() + timeout
+    while time.monotonic() < deadline:
+        packet = read_packet(link, deadline - time.monotonic())
+        if packet is not None and packet[1] == OP_TEXT and packet[2].decode().startswith(expected):
+            return
+    sys.exit("timeout waiting for " + expected)
+
+
+def report(name, latencies, elapsed):
+    latencies = sorted(latencies)
+    count = len(latencies)
+    print("%-16s n=%d avg=%.0fus p50=%.0fus p99=%.0fus throughput=%.0f cmd/s" % (
+        name, count, sum(latencies) / count * 1e6, latencies[count // 2] * 1e6,
+        latencies[min(count - 1, count * 99 // 100)] * 1e6, count / elapsed))
+
+
+def bench_text(link, command, count):
+    latencies = []
+    start = time.monotonic()
+    for _ in range(count):
+        sent = time.monotonic()
+        link.send((command + "\n").encode())
+        wait_text(link, "ACK:")
+        latencies.append(time.monotonic() - sent)
+    report("text", latencies, time.monotonic() - start)
+
+
+def bench_binary(link, command, count, window):
+    """Sends count commands keeping up to window of them in flight, acknowledgements matched by seq."""
+    sent = {}
+    latencies = []
+    refused = 0
+    seq = 0
+    start = time.monotonic()
+    while len(latencies) < count:
+        while len(sent) < window and seq < count:
+            sent[seq & 0xFF] = time.monotonic()
+            link.send(encode_command(seq, command))
+            seq += 1
+        packet = read_packet(link)
+        if packet is None:
+            sys.exit("timeout waiting for an acknowledgement")
+        ack_seq, opcode, payload = packet
+        if opcode != OP_ACK or ack_seq not in sent:
+            continue
+        latencies.append(time.monotonic() - sent.pop(ack_seq))
+        refused += payload[0] != ACK_OK
+    report("binary window=%d" % window, latencies, time.monotonic() - start)
+    if refused:
+        print("  %d commands refused" % refused)
+
+
+def bench(link, args):
+    link.send(b"ESP32?\n")
+    wait_text(link, "ESP32 ready")
+    wait_text(link, "INIT:DONE")
+    bench_text(link, args.command, args.count)
+
+    link.send(b"ESP32?BIN\n")
+    wait_text(link, "ESP32 ready BIN")
+    wait_binary_text(link, "INIT:DONE")
+    bench_binary(link, args.command, args.count, 1)
+    bench_binary(link, args.command, args.count, args.window)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    target = parser.add_mutually_exclusive_group(required=True)
+    target.add_argument("--port", help="serial port of the board")
+    target.add_argument("--exec", dest="command_line", help="native program to run as loopback")
+    sub = parser.add_subparsers(dest="action", required=True)
+    bench_parser = sub.add_parser("bench", help="compare the text and binary round trips")
+    bench_parser.add_argument("--command", default="P", help="command sent by the benchmark")
+    bench_parser.add_argument("--count", type=int, default=200, help="commands per run")
+    bench_parser.add_argument("--window", type=int, default=8, help="commands in flight when pipelined")
+    args = parser.parse_args()
+
+    link = Link(port=args.port, command=args.command_line)
+    if args.action == "bench":
+        bench(link, args)
+
+
+if __name__ == "__main__":
+    main()
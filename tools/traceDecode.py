@@ -0,0 +1,133 @@
+"""
+Decoder turning a TRACE? dump of the firmware into a Chrome trace timeline.
+
+The firmware records relay transitions, screens, frame transfers, state changes and commands in
+an in-RAM ring of 8-byte records (see include/trace.h). The TRACE? command prints them as
+hexadecimal lines between TRACE:BEGIN and TRACE:END. This script reads a serial log holding such a
+dump, other lines being ignored, and writes a JSON file to open in chrome://tracing or
+https://ui.perfetto.dev.
+
+Usage: python tools/traceDecode.py capture.log [-o trace.json]
+Without file the log is read from the standard input.
+"""
+
+import argparse
+import json
+import sys
+
+TRACE_COMMAND = 1
+TRACE_ACK = 2
+TRACE_RELAYS = 3
+TRACE_SCREEN = 4
+TRACE_FRAME_BEGIN = 5
+TRACE_FRAME_END = 6
+TRACE_STATE = 7
+
+SCREENS = ["loading", "waiting", "ready", "joystick", "starting", "stopping", "stopped", "progress"]
+STATES = ["WAITING", "CONFIG", "READY"]
+
+# Timeline rows
+TID_COMMANDS = 1
+TID_SCREENS = 2
+TID_RENDER = 3
+TID_STATE = 4
+
+
+def parse_dump(lines):
+    """Returns the records (time, event, arg8, arg16) of the last dump of the log."""
+    records = None
+    last = None
+    for line in lines:
+        line = line.strip()
+        if line.startswith("TRACE:BEGIN"):
+            records = []
+        elif line == "TRACE:END":
+            if records is not None:
+                last = records
+            records = None
+        elif line.startswith("TRACE:") and records is not None:
+            data = line[6:]
+            for i in range(0, len(data) - 15, 16):
+                records.append((int(data[i:i + 8], 16), int(data[i + 8:i + 10], 16),
+                                int(data[i + 10:i + 12], 16), int(data[i + 12:i + 16], 16)))
+    if last is None:
+        sys.exit("no complete TRACE:BEGIN ... TRACE:END dump found")
+    return last
+
+
+def unwrap(records):
+    """Turns the 32-bit micros() times into increasing times, the dump being in recording order."""
+    offset = 0
+    previous = None
+    result = []
+    for time, event, arg8, arg16 in records:
+        if event == 0:
+            continue
+        if previous is not None and time + offset < previous - (1 << 31):
+            offset += 1 << 32
+        previous = time + offset
+        result.append((time + offset, event, arg8, arg16))
+    return result
+
+
+def to_chrome(records):
+    events = [
+        {"ph": "M", "name": "thread_name", "pid": 0, "tid": TID_COMMANDS, "args": {"name": "commands"}},
+        {"ph": "M", "name": "thread_name", "pid": 0, "tid": TID_SCREENS, "args": {"name": "screens"}},
+        {"ph": "M", "name": "thread_name", "pid": 0, "tid": TID_RENDER, "args": {"name": "render"}},
+        {"ph": "M", "name": "thread_name", "pid": 0, "tid": TID_STATE, "args": {"name": "state"}},
+    ]
+    state = None
+    for time, event, arg8, arg16 in records:
+        if event == TRACE_COMMAND:
+            value = arg16 - 0x10000 if arg16 & 0x8000 else arg16
+            name = "ESP32?" if arg8 == ord("H") else "%c:%d" % (arg8, value)
+            events.append({"ph": "i", "s": "t", "name": name, "cat": "command",
+                           "ts": time, "pid": 0, "tid": TID_COMMANDS})
+        elif event == TRACE_ACK:
+            name = "ACK:%c" % arg8 if arg16 else "ACK:?"
+            events.append({"ph": "i", "s": "t", "name": name, "cat": "ack",
+                           "ts": time, "pid": 0, "tid": TID_COMMANDS})
+        elif event == TRACE_RELAYS:
+            events.append({"ph": "C", "name": "relays", "ts": time, "pid": 0,
+                           "args": {"relay%d" % r: (arg8 >> r) & 1 for r in range(8)}})
+            events.append({"ph": "i", "s": "p", "name": "relays %02x" % arg8, "cat": "relays",
+                           "ts": time, "pid": 0, "tid": TID_COMMANDS, "args": {"changed": "%02x" % arg16}})
+        elif event == TRACE_SCREEN:
+            name = SCREENS[arg8] if arg8 < len(SCREENS) else "screen %d" % arg8
+            if arg8 == SCREENS.index("progress"):
+                name += " %d" % arg16
+            events.append({"ph": "i", "s": "t", "name": name, "cat": "screen",
+                           "ts": time, "pid": 0, "tid": TID_SCREENS})
+        elif event == TRACE_FRAME_BEGIN:
+            events.append({"ph": "B", "name": "frame", "cat": "frame", "ts": time, "pid": 0, "tid": TID_RENDER})
+        elif event == TRACE_FRAME_END:
+            events.append({"ph": "E", "ts": time, "pid": 0, "tid": TID_RENDER, "args": {"bytes": arg16}})
+        elif event == TRACE_STATE:
+            if state is not None:
+                events.append({"ph": "E", "ts": time, "pid": 0, "tid": TID_STATE})
+            state = STATES[arg8] if arg8 < len(STATES) else "state %d" % arg8
+            events.append({"ph": "B", "name": state, "cat": "state", "ts": time, "pid": 0, "tid": TID_STATE})
+    return {"traceEvents": events, "displayTimeUnit": "ms"}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("log", nargs="?", help="serial log holding a TRACE? dump")
+    parser.add_argument("-o", "--output", default="trace.json", help="Chrome trace file to write")
+    args = parser.parse_args()
+
+    if args.log:
+        with open(args.log, errors="replace") as log:
+            records = parse_dump(log)
+    else:
+        records = parse_dump(sys.stdin)
+
+    records = unwrap(records)
+    with open(args.output, "w") as output:
+        json.dump(to_chrome(records), output, indent=1)
+    print("%d records written to %s" % (len(records), args.output))
+
+
+if __name__ == "__main__":
+    main()